@@ -319,6 +319,7 @@ void customlevelclass::reset(void)
     script.clearcustom();
 
     onewaycol_override = false;
+    graphics.cleartintedtiles();
 }
 
 const int* customlevelclass::loadlevel( int rxi, int ryi )
@@ -1184,7 +1185,7 @@ bool customlevelclass::load(std::string& _path)
                 {
                     if (headerfound)
                     {
-                        script.customscripts.push_back(script_);
+                        script.addcustomscript(script_);
                     }
 
                     script_.name = std::string(&pText[prev_start], len - 1);
@@ -1206,7 +1207,7 @@ next:
             /* Add the last script */
             if (headerfound)
             {
-                script.customscripts.push_back(script_);
+                script.addcustomscript(script_);
             }
         }
     }
@@ -1423,9 +1424,10 @@ bool customlevelclass::save(const std::string& _path)
     }
 
     std::string scriptString;
-    for(size_t i = 0; i < script.customscripts.size(); i++)
+    const std::vector<Script>& customscripts = script.getcustomscripts();
+    for(size_t i = 0; i < customscripts.size(); i++)
     {
-        Script& script_ = script.customscripts[i];
+        const Script& script_ = customscripts[i];
 
         scriptString += script_.name + ":|";
         for (size_t ii = 0; ii < script_.contents.size(); ++ii)
@@ -115,9 +115,10 @@ void editorclass::gethooks(void)
 {
     //Scan through the script and create a hooks list based on it
     hooklist.clear();
-    for (size_t i = 0; i < script.customscripts.size(); i++)
+    const std::vector<Script>& customscripts = script.getcustomscripts();
+    for (size_t i = 0; i < customscripts.size(); i++)
     {
-        Script& script_ = script.customscripts[i];
+        const Script& script_ = customscripts[i];
 
         hooklist.push_back(script_.name);
     }
@@ -128,15 +129,10 @@ void editorclass::loadhookineditor(const std::string& t)
     //Find hook t in the scriptclass, then load it into the editor
     clearscriptbuffer();
 
-    for(size_t i = 0; i < script.customscripts.size(); i++)
+    const int index = script.findcustomscript(t);
+    if (index != -1)
     {
-        Script& script_ = script.customscripts[i];
-
-        if(script_.name == t)
-        {
-            sb = script_.contents;
-            break;
-        }
+        sb = script.getcustomscripts()[index].contents;
     }
 
     if(sb.empty())
@@ -153,21 +149,13 @@ void editorclass::addhooktoscript(const std::string& t)
     Script script_;
     script_.name = t;
     script_.contents = sb;
-    script.customscripts.push_back(script_);
+    script.addcustomscript(script_);
 }
 
 void editorclass::removehookfromscript(const std::string& t)
 {
-    /* Find hook t in the scriptclass, then removes it (and any other code with it)
-     * When this loop reaches the end, it wraps to SIZE_MAX; SIZE_MAX + 1 is 0 */
-    size_t i;
-    for (i = script.customscripts.size() - 1; i + 1 > 0; --i)
-    {
-        if (script.customscripts[i].name == t)
-        {
-            script.customscripts.erase(script.customscripts.begin() + i);
-        }
-    }
+    //Find hook t in the scriptclass, then removes it (and any other code with it)
+    script.removecustomscript(t);
 }
 
 void editorclass::removehook(const std::string& t)
@@ -196,11 +184,8 @@ void editorclass::addhook(const std::string& t)
 bool editorclass::checkhook(const std::string& t)
 {
     //returns true if hook t already is in the list
-    for(size_t i=0; i<hooklist.size(); i++)
-    {
-        if(hooklist[i]==t) return true;
-    }
-    return false;
+    //hooklist always holds the same names as script.customscripts
+    return script.findcustomscript(t) != -1;
 }
 
 
@@ -621,8 +606,8 @@ void editorrender(void)
                 drawRect.x += tpoint.x;
                 drawRect.y += tpoint.y;
                 for (int j = 0; j < 4; j++) {
-                    if (custom_gray) BlitSurfaceTinted(graphics.entcolours[obj.customplatformtile],NULL, graphics.backBuffer, &drawRect, gray_ct);
-                    else BlitSurfaceStandard(graphics.entcolours[obj.customplatformtile],NULL, graphics.backBuffer, &drawRect);
+                    if (custom_gray) BlitSurfaceTinted(graphics.entcolours.surface, &graphics.entcolours.rects[obj.customplatformtile], graphics.backBuffer, &drawRect, gray_ct);
+                    else BlitSurfaceStandard(graphics.entcolours.surface, &graphics.entcolours.rects[obj.customplatformtile], graphics.backBuffer, &drawRect);
                     drawRect.x += 8;
                 }
 
@@ -654,8 +639,8 @@ void editorrender(void)
                     drawRect.x += tpoint.x;
                     drawRect.y += tpoint.y;
                     for (int j = 0; j < 4; j++) {
-                        if (custom_gray) BlitSurfaceTinted(graphics.entcolours[obj.customplatformtile],NULL, graphics.backBuffer, &drawRect, gray_ct);
-                        else BlitSurfaceStandard(graphics.entcolours[obj.customplatformtile],NULL, graphics.backBuffer, &drawRect);
+                        if (custom_gray) BlitSurfaceTinted(graphics.entcolours.surface, &graphics.entcolours.rects[obj.customplatformtile], graphics.backBuffer, &drawRect, gray_ct);
+                        else BlitSurfaceStandard(graphics.entcolours.surface, &graphics.entcolours.rects[obj.customplatformtile], graphics.backBuffer, &drawRect);
                         drawRect.x += 8;
                     }
                 }
@@ -682,8 +667,8 @@ void editorrender(void)
                 drawRect.x += tpoint.x;
                 drawRect.y += tpoint.y;
                 for (int j = 0; j < 4; j++) {
-                    if (custom_gray) BlitSurfaceTinted(graphics.entcolours[obj.customplatformtile],NULL, graphics.backBuffer, &drawRect, gray_ct);
-                    else BlitSurfaceStandard(graphics.entcolours[obj.customplatformtile],NULL, graphics.backBuffer, &drawRect);
+                    if (custom_gray) BlitSurfaceTinted(graphics.entcolours.surface, &graphics.entcolours.rects[obj.customplatformtile], graphics.backBuffer, &drawRect, gray_ct);
+                    else BlitSurfaceStandard(graphics.entcolours.surface, &graphics.entcolours.rects[obj.customplatformtile], graphics.backBuffer, &drawRect);
                     drawRect.x += 8;
                 }
 
@@ -927,7 +912,7 @@ void editorrender(void)
                 SDL_Rect drawRect = graphics.sprites_rect;
                 drawRect.x += tpoint.x;
                 drawRect.y += tpoint.y;
-                BlitSurfaceColoured(graphics.sprites[ed.ghosts[i].frame],NULL, graphics.ghostbuffer, &drawRect, graphics.ct);
+                BlitSurfaceColoured(graphics.sprites.surface, &graphics.sprites.rects[ed.ghosts[i].frame], graphics.ghostbuffer, &drawRect, graphics.ct);
             }
         }
         SDL_BlitSurface(graphics.ghostbuffer, NULL, graphics.backBuffer, NULL);
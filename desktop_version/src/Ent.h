@@ -24,37 +24,44 @@ public:
     bool ishumanoid(void);
 
 public:
+    /* Everything updateentitylogic(), testwallsx/y() and entitymapcollision()
+     * read for every entity every frame comes first, so it's in the first
+     * cache line or two. Don't put anything cold up here. Entities are
+     * still stored as whole structs; nothing has measured how much this
+     * order helps yet. */
+    int rule, type;
+    int xp, yp;
+    int oldxp, oldyp;
+    float newxp, newyp;
+    float vx, vy, ax, ay;
+    int cx, cy, w, h;
+
+    int state;
+    int onwall, onxwall, onywall;
+    bool gravity;
+    int onground, onroof;
+    int lerpoldxp, lerpoldyp;
+
     //Fundamentals
     bool invis;
-    int type, size, tile, rule;
-    int state, statedelay;
+    bool isplatform;
+    bool harmful;
+    int size, tile;
+    int statedelay;
     int behave, animate;
     float para;
     int life, colour;
-
-    //Position and velocity
-    int oldxp, oldyp;
-    float ax, ay, vx, vy;
-    int cx, cy, w, h;
-    float newxp, newyp;
-    bool isplatform;
     int x1,y1,x2,y2;
+
     //Collision Rules
     int onentity;
-    bool harmful;
-    int onwall, onxwall, onywall;
 
-    //Platforming specific
-    bool gravity;
-    int onground, onroof;
     //Animation
     int framedelay, drawframe, walkingframe, dir, actionframe;
     int collisionframedelay, collisiondrawframe, collisionwalkingframe;
     int visualonground, visualonroof;
-    int yp;int xp;
 
     Uint32 realcol;
-    int lerpoldxp, lerpoldyp;
 };
 
 #endif /* ENT_H */
@@ -2,6 +2,8 @@
 #include "Entity.h"
 
 #include <SDL.h>
+#include <algorithm>
+#include <functional>
 
 #include "CustomLevels.h"
 #include "Game.h"
@@ -87,6 +89,11 @@ void entityclass::init(void)
     SDL_memset(customcollect, false, sizeof(customcollect));
 
     k = 0;
+
+    /* Enough that spawning in the middle of a frame doesn't reallocate */
+    entities.reserve(entities_reserve);
+    freeentities.reserve(entities_reserve);
+    entities_highwater = 0;
 }
 
 void entityclass::resetallflags(void)
@@ -1100,9 +1107,23 @@ void entityclass::createblock( int t, int xp, int yp, int w, int h, int trig /*=
     if (!reuse)
     {
         blocks.push_back(block);
+        gridblock(blocks.size() - 1, true);
+    }
+    else
+    {
+        gridblock(blockptr - &blocks[0], true);
     }
 }
 
+static bool isdisabled(const entclass& entity)
+{
+    return entity.invis
+    && entity.size == -1
+    && entity.type == -1
+    && entity.rule == -1
+    && !entity.isplatform;
+}
+
 /* Disable entity, and return true if entity was successfully disabled */
 bool entityclass::disableentity(int t)
 {
@@ -1117,6 +1138,12 @@ bool entityclass::disableentity(int t)
         return false;
     }
 
+    if (!isdisabled(entities[t]))
+    {
+        freeentities.push_back(t);
+        std::push_heap(freeentities.begin(), freeentities.end(), std::greater<int>());
+    }
+
     entities[t].invis = true;
     entities[t].size = -1;
     entities[t].type = -1;
@@ -1129,6 +1156,14 @@ bool entityclass::disableentity(int t)
 void entityclass::removeallblocks(void)
 {
     blocks.clear();
+
+    for (int i = 0; i < numblocktypes; i++)
+    {
+        for (int j = 0; j < blockgrid_w * blockgrid_h; j++)
+        {
+            blockgrid[i][j].clear();
+        }
+    }
 }
 
 void entityclass::disableblock( int t )
@@ -1139,6 +1174,8 @@ void entityclass::disableblock( int t )
         return;
     }
 
+    gridblock(t, false);
+
     blocks[t].wp = 0;
     blocks[t].hp = 0;
 
@@ -1152,6 +1189,8 @@ void entityclass::moveblockto(int x1, int y1, int x2, int y2, int w, int h)
     {
         if (blocks[i].xp == x1 && blocks[i].yp == y1)
         {
+            gridblock(i, false);
+
             blocks[i].xp = x2;
             blocks[i].yp = y2;
 
@@ -1159,6 +1198,8 @@ void entityclass::moveblockto(int x1, int y1, int x2, int y2, int w, int h)
             blocks[i].hp = h;
 
             blocks[i].rectset(blocks[i].xp, blocks[i].yp, blocks[i].wp, blocks[i].hp);
+
+            gridblock(i, true);
             break;
         }
     }
@@ -1225,6 +1266,89 @@ static void entityclonefix(entclass* entity)
     }
 }
 
+/* What createentity() sets up for each type before the parts that depend
+ * on its arguments or the room. Anything not in here is left as clear()
+ * leaves it, and types not in the table only get their type set. */
+struct EntityArchetype
+{
+    int t;
+    int type, rule, size, tile, colour;
+    int cx, cy, w, h;
+    int dir, onentity, animate, life;
+    bool harmful, gravity, invis;
+};
+
+static const EntityArchetype entityarchetypes[] = {
+    //t, type, rule, size, tile, colour, cx, cy,  w,  h, dir, onentity, animate, life, harmful, gravity, invis
+    { 0,    0,    0,    0,    0,      0,  6,  2, 12, 21,   1,        0,       0,    0,   false,    true, false}, // Player
+    { 1,    1,    1,    0,   24,      8,  0,  0, 16, 16,   0,        0,       0,    0,    true,   false, false}, // Simple enemy, bouncing off the walls
+    { 2,    1,    2,    2,    1,      0,  0,  0, 32,  8,   0,        0,       0,    0,   false,   false, false}, // A moving platform
+    { 3,    2,    3,    2,    2,      0,  0, -1, 32, 10,   0,        1,     100,    0,   false,   false, false}, // Disappearing platforms
+    { 4,    3,    6,    1,   10,      0,  0, -1,  8, 10,   0,        1,     100,    0,   false,   false, false}, // Breakable blocks
+    { 5,    4,    3,    0,   11,      0,  0,  0, 16, 16,   0,        1,     100,    0,   false,   false, false}, // Gravity Tokens
+    { 6,    5,    2,    3,    0,      1,  0,  0, 16, 16,   0,        0,       0,   12,   false,   false, false}, // Decorative particles
+    { 7,    5,    2,    3,    0,      2,  0,  0, 16, 16,   0,        0,       0,   12,   false,   false, false}, // Decorative particles
+    { 8,    6,    3,    4,   48,      0,  0,  0,  8,  8,   0,        1,     100,    0,   false,   false, false}, // Small collectibles
+    { 9,    7,    3,    0,   22,      3,  0,  0, 16, 16,   0,        1,     100,    0,   false,   false, false}, // Something Shiny
+    {10,    8,    3,    0,    0,      4,  0,  0, 16, 16,   0,        1,     100,    0,   false,   false, false}, // Savepoint
+    {11,    9,    4,    5,    0,      0,  0,  0, 16,  1,   0,        1,       0,    0,   false,   false, false}, // Horizontal Gravity Line
+    {12,   10,    5,    6,    0,      0,  0,  0,  1, 16,   0,        1,       0,    0,   false,   false, false}, // Vertical Gravity Line
+    {13,   11,    3,    0,   18,     10,  0,  0, 16, 16,   0,        1,       2,    0,   false,   false, false}, // Warp token
+    {14,  100,    3,    7,    1,    100,  0,  0, 96, 96,   0,        1,     100,    0,   false,   false, false}, // Teleporter
+    {15,   12,    6,    0,  144,     13,  6,  2, 12, 21,   0,        0,       0,    0,   false,    true, false}, // Crew Member (warp zone)
+    {16,   12,    7,    0,  150,     14,  6,  2, 12, 21,   1,        0,       0,    0,   false,    true, false}, // Crew Member, upside down (space station)
+    {17,   12,    6,    0,  144,     16,  6,  2, 12, 21,   1,        0,       0,    0,   false,    true, false}, // Crew Member (Lab)
+    {18,   12,    6,    0,    0,      0,  6,  2, 12, 21,   0,        0,       0,    0,   false,    true, false}, // Crew Member (Ship)
+    {19,   12,    6,    0,    0,      6,  6,  2, 12, 21,   1,        0,       0,    0,   false,    true, false}, // Crew Member (Ship) More tests!
+    {20,   13,    3,    0,    0,      4,  0,  0, 16, 16,   0,        1,     100,    0,   false,   false, false}, // Terminal
+    {21,   13,    3,    0,    0,      4,  0,  0, 16, 16,   0,        0,     100,    0,   false,   false, false}, // As above, except doesn't highlight
+    {22,    7,    3,    0,   22,      3,  0,  0, 16, 16,   0,        0,     100,    0,   false,   false, false}, // Fake trinkets
+    {23,   23,    1,   12,   78,     21,  0,  0, 16, 16,   0,        0,       1,    0,    true,   false, false}, // SWN Enemies
+    {24,   14,    6,    0,    0,      0,  6,  2, 12, 21,   1,        0,       0,    0,   false,    true, false}, // Super Crew Member
+    {25,   15,    3,    0,    0,      4,  0,  0, 16, 16,   0,        1,     100,    0,   false,   false, false}, // Trophies
+    {26,   11,    3,   13,   18,      3,  0,  0, 16, 16,   0,        0,     100,    0,   false,   false, false}, // Epilogue super warp token
+    {51,   51,    5,    6,    0,      0,  0,  0,  1, 16,   0,        1,       0,    0,   false,   false,  true}, // Vertical warp line
+    {52,   52,    5,    6,    0,      0,  0,  0,  1, 16,   0,        1,       0,    0,   false,   false,  true}, // Vertical warp line
+    {53,   53,    7,    5,    0,      0,  0,  0, 16,  1,   0,        1,       0,    0,   false,   false,  true}, // Horizontal warp line
+    {54,   54,    7,    5,    0,      0,  0,  0, 16,  1,   0,        1,       0,    0,   false,   false,  true}, // Horizontal warp line
+    {55,   55,    3,    0,    0,      0,  6,  2, 12, 21,   0,        1,       0,    0,   false,    true, false}, // Crew Member (custom, collectable)
+    {56,    1,    1,    0,    0,      0,  0,  0, 16, 16,   0,        0,       0,    0,    true,   false, false}, // Custom enemy
+};
+
+static bool archetypeless(const EntityArchetype& archetype, const int t)
+{
+    return archetype.t < t;
+}
+
+static void applyarchetype(entclass* entity, const int t)
+{
+    const EntityArchetype* end = entityarchetypes + SDL_arraysize(entityarchetypes);
+    const EntityArchetype* archetype = std::lower_bound(entityarchetypes, end, t, archetypeless);
+
+    if (archetype == end || archetype->t != t)
+    {
+        entity->type = t;
+        return;
+    }
+
+    entity->type = archetype->type;
+    entity->rule = archetype->rule;
+    entity->size = archetype->size;
+    entity->tile = archetype->tile;
+    entity->colour = archetype->colour;
+    entity->cx = archetype->cx;
+    entity->cy = archetype->cy;
+    entity->w = archetype->w;
+    entity->h = archetype->h;
+    entity->dir = archetype->dir;
+    entity->onentity = archetype->onentity;
+    entity->animate = archetype->animate;
+    entity->life = archetype->life;
+    entity->harmful = archetype->harmful;
+    entity->gravity = archetype->gravity;
+    entity->invis = archetype->invis;
+}
+
 void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int p1, int p2, int p3, int p4)
 {
     k = entities.size();
@@ -1234,13 +1358,13 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
 
     /* Can we reuse the slot of a disabled entity? */
     bool reuse = false;
-    for (size_t i = 0; i < entities.size(); ++i)
+    while (!freeentities.empty())
     {
-        if (entities[i].invis
-        && entities[i].size == -1
-        && entities[i].type == -1
-        && entities[i].rule == -1
-        && !entities[i].isplatform)
+        const int i = freeentities.front();
+        std::pop_heap(freeentities.begin(), freeentities.end(), std::greater<int>());
+        freeentities.pop_back();
+
+        if (INBOUNDS_VEC(i, entities) && isdisabled(entities[i]))
         {
             reuse = true;
             entptr = &entities[i];
@@ -1283,46 +1407,26 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
     entclass& entity = *entptr;
     entity.xp = xp;
     entity.yp = yp;
-    entity.type = t;
+    applyarchetype(&entity, t);
+
     switch(t)
     {
     case 0: //Player
-        entity.rule = 0; //Playable character
-        entity.tile = 0;
-        entity.colour = 0;
-        entity.cx = 6;
-        entity.cy = 2;
-        entity.w = 12;
-        entity.h = 21;
-        entity.dir = 1;
-
         /* Fix wrong y-position if spawning in on conveyor */
         entity.newxp = xp;
         entity.newyp = yp;
 
         if (meta1 == 1) entity.invis = true;
-
-        entity.gravity = true;
         break;
     case 1: //Simple enemy, bouncing off the walls
-        entity.rule = 1;
         entity.behave = meta1;
         entity.para = meta2;
-        entity.w = 16;
-        entity.h = 16;
-        entity.cx = 0;
-        entity.cy = 0;
 
         entity.x1 = p1;
         entity.y1 = p2;
         entity.x2 = p3;
         entity.y2 = p4;
 
-        entity.harmful = true;
-        entity.tile = 24;
-        entity.animate = 0;
-        entity.colour = 8;
-
         if  (game.roomy == 111 && (game.roomx >= 113 && game.roomx <= 117))
         {
             entity.setenemy(0);
@@ -1350,11 +1454,6 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
         }
         break;
     case 2: //A moving platform
-        entity.rule = 2;
-        entity.type = 1;
-        entity.size = 2;
-        entity.tile = 1;
-
         if (customplatformtile > 0){
             entity.tile = customplatformtile;
         }else if (platformtile > 0) {
@@ -1369,9 +1468,6 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
           if (gridmatch(p1, p2, p3, p4, -32, -40, 352, 264)) entity.tile = 27;
         }
 
-        entity.w = 32;
-        entity.h = 8;
-
         if (meta1 <= 1) vertplatforms = true;
         if (meta1 >= 2  && meta1 <= 5) horplatforms = true;
         if (meta1 == 14 || meta1 == 15) horplatforms = true; //special case for last part of Space Station
@@ -1418,10 +1514,6 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
         createblock(0, xp, yp, 32, 8);
         break;
     case 3: //Disappearing platforms
-        entity.rule = 3;
-        entity.type = 2;
-        entity.size = 2;
-        entity.tile = 2;
         //appearance again depends on location
         if(customplatformtile>0)
         {
@@ -1437,102 +1529,41 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
             if (game.roomx == 50 && game.roomy == 52) entity.tile = 22;
         }
 
-        entity.cy = -1;
-        entity.w = 32;
-        entity.h = 10;
         entity.behave = meta1;
         entity.para = meta2;
-        entity.onentity = 1;
-        entity.animate = 100;
 
         createblock(0, xp, yp, 32, 8);
         break;
     case 4: //Breakable blocks
-        entity.rule = 6;
-        entity.type = 3;
-        entity.size = 1;
-        entity.tile = 10;
-        entity.cy = -1;
-        entity.w = 8;
-        entity.h = 10;
         entity.behave = meta1;
         entity.para = meta2;
-        entity.onentity = 1;
-        entity.animate = 100;
 
         createblock(0, xp, yp, 8, 8);
         break;
     case 5: //Gravity Tokens
-        entity.rule = 3;
-        entity.type = 4;
-        entity.size = 0;
-        entity.tile = 11;
-        entity.w = 16;
-        entity.h = 16;
         entity.behave = meta1;
         entity.para = meta2;
-        entity.onentity = 1;
-        entity.animate = 100;
         break;
     case 6: //Decorative particles
-        entity.rule = 2;
-        entity.type = 5;  //Particles
-        entity.colour = 1;
-        entity.size = 3;
         entity.vx = meta1;
         entity.vy = meta2;
-
-        entity.life = 12;
         break;
     case 7: //Decorative particles
-        entity.rule = 2;
-        entity.type = 5;  //Particles
-        entity.colour = 2;
-        entity.size = 3;
         entity.vx = meta1;
         entity.vy = meta2;
-
-        entity.life = 12;
         break;
     case 8: //Small collectibles
-        entity.rule = 3;
-        entity.type = 6;
-        entity.size = 4;
-        entity.tile = 48;
-        entity.w = 8;
-        entity.h = 8;
-        entity.onentity = 1;
-        entity.animate = 100;
-
         //Check if it's already been collected
         entity.para = meta1;
         if (!INBOUNDS_ARR(meta1, collect) || collect[meta1]) return;
         break;
     case 9: //Something Shiny
-        entity.rule = 3;
-        entity.type = 7;
-        entity.size = 0;
-        entity.tile = 22;
-        entity.w = 16;
-        entity.h = 16;
-        entity.colour = 3;
-        entity.onentity = 1;
-        entity.animate = 100;
-
         //Check if it's already been collected
         entity.para = meta1;
         if (!INBOUNDS_ARR(meta1, collect) || collect[meta1]) return;
         break;
     case 10: //Savepoint
-        entity.rule = 3;
-        entity.type = 8;
-        entity.size = 0;
         entity.tile = 20 + meta1;
-        entity.w = 16;
-        entity.h = 16;
-        entity.colour = 4;
-        entity.onentity = 1;
-        entity.animate = 100;
         entity.para = meta2;
 
         if (game.savepoint == meta2)
@@ -1547,99 +1578,31 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
         }
         break;
     case 11: //Horizontal Gravity Line
-        entity.rule = 4;
-        entity.type = 9;
-        entity.size = 5;
-        entity.life = 0;
         entity.w = meta1;
-        entity.h = 1;
-        entity.onentity = 1;
         break;
     case 12: //Vertical Gravity Line
-        entity.rule = 5;
-        entity.type = 10;
-        entity.size = 6;
-        entity.life = 0;
-        entity.w = 1;
         entity.h = meta1;
         //entity.colour = 0;
-        entity.onentity = 1;
         break;
     case 13: //Warp token
-        entity.rule = 3;
-        entity.type = 11;
-        entity.size = 0;
-        entity.tile = 18;
-        entity.w = 16;
-        entity.h = 16;
-        entity.colour = 10;
-        entity.onentity = 1;
-        entity.animate = 2;
         //Added in port, hope it doesn't break anything
         entity.behave = meta1;
         entity.para = meta2;
         break;
     case 14: // Teleporter
-        entity.rule = 3;
-        entity.type = 100;
-        entity.size = 7;
-        entity.tile = 1; //inactive
-        entity.w = 96;
-        entity.h = 96;
-        entity.colour = 100;
-        entity.onentity = 1;
-        entity.animate = 100;
         entity.para = meta2;
         break;
     case 15: // Crew Member (warp zone)
-        entity.rule = 6;
-        entity.type = 12; //A special case!
-        entity.tile = 144;
-        entity.colour = 13; //144 for sad :(
-        entity.cx = 6;
-        entity.cy = 2;
-        entity.w = 12;
-        entity.h = 21;
-        entity.dir = 0;
-
         entity.state = meta1;
-
-        entity.gravity = true;
         break;
     case 16: // Crew Member, upside down (space station)
-        entity.rule = 7;
-        entity.type = 12; //A special case!
-        entity.tile = 144+6;
-        entity.colour = 14; //144 for sad (upside down+12):(
-        entity.cx = 6;
-        entity.cy = 2;
-        entity.w = 12;
-        entity.h = 21;
-        entity.dir = 1;
-
         entity.state = meta1;
-
-        entity.gravity = true;
         break;
     case 17: // Crew Member (Lab)
-        entity.rule = 6;
-        entity.type = 12; //A special case!
-        entity.tile = 144;
-        entity.colour = 16; //144 for sad :(
-        entity.cx = 6;
-        entity.cy = 2;
-        entity.w = 12;
-        entity.h = 21;
-        entity.dir = 1;
-
         entity.state = meta1;
-
-        entity.gravity = true;
         break;
     case 18: // Crew Member (Ship)
         //This is the scriping crewmember
-        entity.rule = 6;
-        entity.type = 12; //A special case!
         entity.colour = meta1;
         if (meta2 == 0)
         {
@@ -1649,11 +1612,6 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
         {
             entity.tile = 144;
         }
-        entity.cx = 6;
-        entity.cy = 2;
-        entity.w = 12;
-        entity.h = 21;
-        entity.dir = 0;
 
         entity.state = p1;
         entity.para = p2;
@@ -1663,85 +1621,34 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
             entity.dir = p2;
         }
 
-        entity.gravity = true;
         break;
     case 19: // Crew Member (Ship) More tests!
-        entity.rule = 6;
-        entity.type = 12; //A special case!
-        entity.tile = 0;
-        entity.colour = 6; //54 for sad :(
-        entity.cx = 6;
-        entity.cy = 2;
-        entity.w = 12;
-        entity.h = 21;
-        entity.dir = 1;
-
         entity.state = meta1;
-
-        entity.gravity = true;
         break;
     case 20: //Terminal
-        entity.rule = 3;
-        entity.type = 13;
-        entity.size = 0;
         entity.tile = 16 + meta1;
-        entity.w = 16;
-        entity.h = 16;
-        entity.colour = 4;
-        entity.onentity = 1;
-        entity.animate = 100;
         entity.para = meta2;
         break;
     case 21: //as above, except doesn't highlight
-        entity.rule = 3;
-        entity.type = 13;
-        entity.size = 0;
         entity.tile = 16 + meta1;
-        entity.w = 16;
-        entity.h = 16;
-        entity.colour = 4;
-        entity.onentity = 0;
-        entity.animate = 100;
         entity.para = meta2;
         break;
     case 22: //Fake trinkets, only appear if you've collected them
-        entity.rule = 3;
-        entity.type = 7;
-        entity.size = 0;
-        entity.tile = 22;
-        entity.w = 16;
-        entity.h = 16;
-        entity.colour = 3;
-        entity.onentity = 0;
-        entity.animate = 100;
-
         //Check if it's already been collected
         entity.para = meta1;
         if (INBOUNDS_ARR(meta1, collect) && !collect[meta1]) return;
         break;
     case 23: //SWN Enemies
         //Given a different behavior, these enemies are especially for SWN mode and disappear outside the screen.
-        entity.rule = 1;
-        entity.type = 23;
         entity.behave = meta1;
         entity.para = meta2;
-        entity.w = 16;
-        entity.h = 16;
-        entity.cx = 0;
-        entity.cy = 0;
 
         entity.x1 = -2000;
         entity.y1 = -100;
         entity.x2 = 5200;
         entity.y2 = 340;
 
-        entity.harmful = true;
-
         //initilise tiles here based on behavior
-        entity.size = 12; //don't wrap around
-        entity.colour = 21;
-        entity.tile = 78; //default case
-        entity.animate = 1;
         if (game.swngame == 1)
         {
             //set colour based on current state
@@ -1750,8 +1657,6 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
         break;
     case 24: // Super Crew Member
         //This special crewmember is way more advanced than the usual kind, and can interact with game objects
-        entity.rule = 6;
-        entity.type = 14; //A special case!
         entity.colour = meta1;
         if (meta1 == 16)
         {
@@ -1770,11 +1675,6 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
         {
             entity.tile = 144;
         }
-        entity.cx = 6;
-        entity.cy = 2;
-        entity.w = 12;
-        entity.h = 21;
-        entity.dir = 1;
 
         entity.x1 = -2000;
         entity.y1 = -100;
@@ -1789,17 +1689,8 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
             entity.dir = p2;
         }
 
-        entity.gravity = true;
         break;
     case 25: //Trophies
-        entity.rule = 3;
-        entity.type = 15;
-        entity.size = 0;
-        entity.w = 16;
-        entity.h = 16;
-        entity.colour = 4;
-        entity.onentity = 1;
-        entity.animate = 100;
         entity.para = meta2;
 
         //Decide tile here based on given achievement: both whether you have them and what they are
@@ -1967,17 +1858,7 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
 
         break;
     case 26: //Epilogue super warp token
-        entity.rule = 3;
-        entity.type = 11;
-        entity.size = 0;
-        entity.tile = 18;
-        entity.w = 16;
-        entity.h = 16;
-        entity.colour = 3;
-        entity.onentity = 0;
-        entity.animate = 100;
         entity.para = meta2;
-        entity.size = 13;
         break;
 
     /* Warp lines */
@@ -1985,25 +1866,15 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
     case 52: /* Vertical */
     case 53: /* Horizontal */
     case 54: /* Horizontal */
-        entity.type = t;
-        entity.onentity = 1;
-        entity.invis = true;
-        entity.life = 0;
         switch (t)
         {
         case 51:
         case 52:
-            entity.rule = 5;
-            entity.size = 6;
-            entity.w = 1;
             entity.h = meta1;
             break;
         case 53:
         case 54:
-            entity.rule = 7;
-            entity.size = 5;
             entity.w = meta1;
-            entity.h = 1;
             break;
         }
         if (map.custommode)
@@ -2016,8 +1887,6 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
       case 55: // Crew Member (custom, collectable)
         //1 - position in array
         //2 - colour
-        entity.rule = 3;
-        entity.type = 55;
         if(INBOUNDS_ARR(meta2, customcrewmoods)
         && customcrewmoods[meta2]==1){
           entity.tile = 144;
@@ -2025,39 +1894,23 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
           entity.tile = 0;
         }
         entity.colour = graphics.crewcolour(meta2);
-        entity.cx = 6;
-        entity.cy = 2;
-        entity.w = 12;
-        entity.h = 21;
-        entity.dir = 0;
 
         entity.state = 0;
-        entity.onentity = 1;
         //entity.state = meta1;
 
-        entity.gravity = true;
-
         //Check if it's already been collected
         entity.para = meta1;
         if (!INBOUNDS_ARR(meta1, customcollect) || customcollect[meta1]) return;
         break;
       case 56: //Custom enemy
-        entity.rule = 1;
-        entity.type = 1;
         entity.behave = meta1;
         entity.para = meta2;
-        entity.w = 16;
-        entity.h = 16;
-        entity.cx = 0;
-        entity.cy = 0;
 
         entity.x1 = p1;
         entity.y1 = p2;
         entity.x2 = p3;
         entity.y2 = p4;
 
-        entity.harmful = true;
-
         switch(customenemy){
           case 0: entity.setenemyroom(4+100, 0+100); break;
           case 1: entity.setenemyroom(2+100, 0+100); break;
@@ -2128,6 +1981,14 @@ void entityclass::createentity(int xp, int yp, int t, int meta1, int meta2, int
     if (!reuse)
     {
         entities.push_back(entity);
+        if (entities.size() > entities_highwater)
+        {
+            entities_highwater = entities.size();
+            if (entities_highwater == entities_reserve + 1)
+            {
+                vlog_debug("More than %i entities at once, past what init() reserved", entities_reserve);
+            }
+        }
     }
 
     /* Fix crewmate facing directions
@@ -4024,9 +3885,10 @@ bool entityclass::checkdamage(bool scm /*= false*/)
             temprect.w = entities[i].w;
             temprect.h = entities[i].h;
 
-            for (size_t j=0; j<blocks.size(); j++)
+            const std::vector<int>& damage = queryblocks(DAMAGE, temprect);
+            for (size_t j = 0; j < damage.size(); j++)
             {
-                if (blocks[j].type == DAMAGE && help.intersects(blocks[j].rect, temprect))
+                if (help.intersects(blocks[damage[j]].rect, temprect))
                 {
                     return true;
                 }
@@ -4051,12 +3913,13 @@ int entityclass::checktrigger(int* block_idx)
             temprect.w = entities[i].w;
             temprect.h = entities[i].h;
 
-            for (size_t j=0; j<blocks.size(); j++)
+            const std::vector<int>& triggers = queryblocks(TRIGGER, temprect);
+            for (size_t j = 0; j < triggers.size(); j++)
             {
-                if (blocks[j].type == TRIGGER && help.intersects(blocks[j].rect, temprect))
+                if (help.intersects(blocks[triggers[j]].rect, temprect))
                 {
-                    *block_idx = j;
-                    return blocks[j].trigger;
+                    *block_idx = triggers[j];
+                    return blocks[triggers[j]].trigger;
                 }
             }
         }
@@ -4077,11 +3940,12 @@ int entityclass::checkactivity(void)
             temprect.w = entities[i].w;
             temprect.h = entities[i].h;
 
-            for (size_t j=0; j<blocks.size(); j++)
+            const std::vector<int>& activities = queryblocks(ACTIVITY, temprect);
+            for (size_t j = 0; j < activities.size(); j++)
             {
-                if (blocks[j].type == ACTIVITY && help.intersects(blocks[j].rect, temprect))
+                if (help.intersects(blocks[activities[j]].rect, temprect))
                 {
-                    return j;
+                    return activities[j];
                 }
             }
         }
@@ -4097,12 +3961,14 @@ int entityclass::getgridpoint( int t )
 bool entityclass::checkplatform(const SDL_Rect& temprect, int* px, int* py)
 {
     //Return true if rectset intersects a moving platform, setups px & py to the platform x & y
-    for (size_t i = 0; i < blocks.size(); i++)
+    const std::vector<int>& platforms = queryblocks(BLOCK, temprect);
+    for (size_t i = 0; i < platforms.size(); i++)
     {
-        if (blocks[i].type == BLOCK && help.intersects(blocks[i].rect, temprect))
+        const blockclass& block = blocks[platforms[i]];
+        if (help.intersects(block.rect, temprect))
         {
-            *px = blocks[i].xp;
-            *py = blocks[i].yp;
+            *px = block.xp;
+            *py = block.yp;
             return true;
         }
     }
@@ -4111,27 +3977,117 @@ bool entityclass::checkplatform(const SDL_Rect& temprect, int* px, int* py)
 
 bool entityclass::checkblocks(const SDL_Rect& temprect, const float dx, const float dy, const float dr, const bool skipdirblocks)
 {
-    for (size_t i = 0; i < blocks.size(); i++)
+    if (!skipdirblocks)
     {
-        if(!skipdirblocks && blocks[i].type == DIRECTIONAL)
+        const std::vector<int>& dirblocks = queryblocks(DIRECTIONAL, temprect);
+        for (size_t i = 0; i < dirblocks.size(); i++)
         {
-            if (dy > 0 && blocks[i].trigger == 0) if (help.intersects(blocks[i].rect, temprect)) return true;
-            if (dy <= 0 && blocks[i].trigger == 1) if (help.intersects(blocks[i].rect, temprect)) return true;
-            if (dx > 0 && blocks[i].trigger == 2) if (help.intersects(blocks[i].rect, temprect)) return true;
-            if (dx <= 0 && blocks[i].trigger == 3) if (help.intersects(blocks[i].rect, temprect)) return true;
+            const blockclass& block = blocks[dirblocks[i]];
+            if (dy > 0 && block.trigger == 0) if (help.intersects(block.rect, temprect)) return true;
+            if (dy <= 0 && block.trigger == 1) if (help.intersects(block.rect, temprect)) return true;
+            if (dx > 0 && block.trigger == 2) if (help.intersects(block.rect, temprect)) return true;
+            if (dx <= 0 && block.trigger == 3) if (help.intersects(block.rect, temprect)) return true;
         }
-        if (blocks[i].type == BLOCK && help.intersects(blocks[i].rect, temprect))
+    }
+
+    const std::vector<int>& solid = queryblocks(BLOCK, temprect);
+    for (size_t i = 0; i < solid.size(); i++)
+    {
+        if (help.intersects(blocks[solid[i]].rect, temprect))
         {
             return true;
         }
-        if (blocks[i].type == SAFE && (dr)==1 && help.intersects(blocks[i].rect, temprect))
+    }
+
+    if (dr == 1)
+    {
+        const std::vector<int>& safe = queryblocks(SAFE, temprect);
+        for (size_t i = 0; i < safe.size(); i++)
         {
-            return true;
+            if (help.intersects(blocks[safe[i]].rect, temprect))
+            {
+                return true;
+            }
         }
     }
     return false;
 }
 
+static void blockgridcells(const SDL_Rect& rect, int* x1, int* y1, int* x2, int* y2)
+{
+    *x1 = SDL_clamp(rect.x / entityclass::blockgrid_cell, 0, entityclass::blockgrid_w - 1);
+    *y1 = SDL_clamp(rect.y / entityclass::blockgrid_cell, 0, entityclass::blockgrid_h - 1);
+    *x2 = SDL_clamp((rect.x + rect.w - 1) / entityclass::blockgrid_cell, 0, entityclass::blockgrid_w - 1);
+    *y2 = SDL_clamp((rect.y + rect.h - 1) / entityclass::blockgrid_cell, 0, entityclass::blockgrid_h - 1);
+}
+
+/* Add block t to (or remove it from) the cells its rect touches. Blocks
+ * with empty rects can't collide with anything, so they're left out. */
+void entityclass::gridblock(const int t, const bool add)
+{
+    if (!INBOUNDS_VEC(t, blocks))
+    {
+        vlog_error("gridblock() out-of-bounds!");
+        return;
+    }
+
+    const blockclass& block = blocks[t];
+    if (block.type < 0 || block.type >= numblocktypes
+    || block.rect.w <= 0 || block.rect.h <= 0)
+    {
+        return;
+    }
+
+    int x1, y1, x2, y2;
+    blockgridcells(block.rect, &x1, &y1, &x2, &y2);
+
+    for (int y = y1; y <= y2; y++)
+    {
+        for (int x = x1; x <= x2; x++)
+        {
+            std::vector<int>& cell = blockgrid[block.type][x + y * blockgrid_w];
+            std::vector<int>::iterator it = std::lower_bound(cell.begin(), cell.end(), t);
+
+            if (add && (it == cell.end() || *it != t))
+            {
+                cell.insert(it, t);
+            }
+            else if (!add && it != cell.end() && *it == t)
+            {
+                cell.erase(it);
+            }
+        }
+    }
+}
+
+/* The blocks of a type that might intersect rect, in the order they are
+ * in blocks, so the first hit is the same as checking every block.
+ * Only valid until the next call. */
+const std::vector<int>& entityclass::queryblocks(const int type, const SDL_Rect& rect)
+{
+    int x1, y1, x2, y2;
+    blockgridcells(rect, &x1, &y1, &x2, &y2);
+
+    if (x1 == x2 && y1 == y2)
+    {
+        return blockgrid[type][x1 + y1 * blockgrid_w];
+    }
+
+    blockquery.clear();
+    for (int y = y1; y <= y2; y++)
+    {
+        for (int x = x1; x <= x2; x++)
+        {
+            const std::vector<int>& cell = blockgrid[type][x + y * blockgrid_w];
+            blockquery.insert(blockquery.end(), cell.begin(), cell.end());
+        }
+    }
+
+    std::sort(blockquery.begin(), blockquery.end());
+    blockquery.erase(std::unique(blockquery.begin(), blockquery.end()), blockquery.end());
+    return blockquery;
+}
+
 bool entityclass::checkwall(const SDL_Rect& temprect, const float dx, const float dy, const float dr, const bool skipblocks, const bool skipdirblocks)
 {
     //Returns true if entity setup in temprect collides with a wall
@@ -4528,6 +4484,22 @@ void entityclass::applyfriction( int t, float xrate, float yrate )
     if (SDL_fabsf(entities[t].vy) < yrate) entities[t].vy = 0.0f;
 }
 
+/* One entity's frame: its behaviour, then physics, then walls. gamelogic()
+ * goes through entities from last to first, and this has to be finished
+ * for one before the next starts; behaviours read other entities, and
+ * expect every entity after them to have already moved this frame.
+ * Returns true if the entity is gone. */
+bool entityclass::stepentity(const int t)
+{
+    if (updateentities(t))      // Behavioral logic
+    {
+        return true;
+    }
+    updateentitylogic(t);       // Basic Physics
+    entitymapcollision(t);      // Collisions with walls
+    return false;
+}
+
 void entityclass::updateentitylogic( int t )
 {
     if (!INBOUNDS_VEC(t, entities))
@@ -4672,6 +4644,35 @@ void entityclass::customwarplinecheck(int i) {
 
 void entityclass::entitycollisioncheck(void)
 {
+    //Nothing in collisioncheck() moves an entity, so sort them once
+    collisionsweep.clear();
+    collisionsweep_maxw = 0;
+    collisionlines.clear();
+    for (size_t i = 0; i < entities.size(); i++)
+    {
+        switch (entities[i].rule)
+        {
+        case 1:
+        case 2:
+        case 3:
+        case 6:
+            //These only do something if they overlap the person
+            if (entities[i].w > 0 && entities[i].h > 0)
+            {
+                collisionsweep.push_back(std::make_pair(entities[i].xp + entities[i].cx, (int) i));
+                collisionsweep_maxw = SDL_max(collisionsweep_maxw, entities[i].w);
+            }
+            break;
+        case 4:
+        case 5:
+        case 7:
+            //Lines check where the person was last frame too
+            collisionlines.push_back(i);
+            break;
+        }
+    }
+    std::sort(collisionsweep.begin(), collisionsweep.end());
+
     for (size_t i = 0; i < entities.size(); i++)
     {
         bool player = entities[i].rule == 0;
@@ -4681,15 +4682,16 @@ void entityclass::entitycollisioncheck(void)
             continue;
         }
 
-        //We test entity to entity
-        for (size_t j = 0; j < entities.size(); j++)
+        //We test entity to entity, in the same order as testing all of them
+        collisioncandidates(i);
+        for (size_t j = 0; j < collisionpairs.size(); j++)
         {
-            if (i == j)
+            if ((int) i == collisionpairs[j])
             {
                 continue;
             }
 
-            collisioncheck(i, j, scm);
+            collisioncheck(i, collisionpairs[j], scm);
         }
     }
 
@@ -4741,6 +4743,40 @@ void entityclass::entitycollisioncheck(void)
     }
 }
 
+/* Fill collisionpairs with every entity collisioncheck() could do
+ * something with for person i, in index order */
+void entityclass::collisioncandidates(const int i)
+{
+    collisionpairs.assign(collisionlines.begin(), collisionlines.end());
+
+    const int left = entities[i].xp + entities[i].cx;
+    const int top = entities[i].yp + entities[i].cy;
+    const int right = left + entities[i].w;
+    const int bottom = top + entities[i].h;
+
+    if (entities[i].w > 0 && entities[i].h > 0)
+    {
+        std::vector<std::pair<int, int> >::const_iterator it = std::lower_bound(
+            collisionsweep.begin(),
+            collisionsweep.end(),
+            std::make_pair(left - collisionsweep_maxw + 1, -1)
+        );
+
+        for (; it != collisionsweep.end() && it->first < right; ++it)
+        {
+            const entclass& entity = entities[it->second];
+            const int y = entity.yp + entity.cy;
+
+            if (it->first + entity.w > left && y < bottom && y + entity.h > top)
+            {
+                collisionpairs.push_back(it->second);
+            }
+        }
+    }
+
+    std::sort(collisionpairs.begin(), collisionpairs.end());
+}
+
 void entityclass::collisioncheck(int i, int j, bool scm /*= false*/)
 {
     if (!INBOUNDS_VEC(i, entities) || !INBOUNDS_VEC(j, entities))
@@ -4771,10 +4807,10 @@ void entityclass::collisioncheck(int i, int j, bool scm /*= false*/)
                 colpoint2.y = entities[j].yp;
                 int drawframe1 = entities[i].collisiondrawframe;
                 int drawframe2 = entities[j].drawframe;
-                std::vector<SDL_Surface*>& spritesvec = graphics.flipmode ? graphics.flipsprites : graphics.sprites;
+                TileSheet& spritesvec = graphics.flipmode ? graphics.flipsprites : graphics.sprites;
                 if (INBOUNDS_VEC(drawframe1, spritesvec) && INBOUNDS_VEC(drawframe2, spritesvec)
-                && graphics.Hitest(spritesvec[drawframe1],
-                                 colpoint1, spritesvec[drawframe2], colpoint2))
+                && graphics.Hitest(spritesvec, drawframe1,
+                                 colpoint1, drawframe2, colpoint2))
                 {
                     //Do the collision stuff
                     game.deathseq = 30;
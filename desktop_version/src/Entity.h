@@ -3,6 +3,7 @@
 
 #include <SDL.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Maths.h"
@@ -96,6 +97,8 @@ public:
 
     bool updateentities(int i);
 
+    bool stepentity(int t);
+
     void animateentities(int i);
 
     void animatehumanoidcollision(const int i);
@@ -127,6 +130,10 @@ public:
 
     bool checkblocks(const SDL_Rect& temprect, const float dx, const float dy, const float dr, const bool skipdirblocks);
 
+    void gridblock(int t, bool add);
+
+    const std::vector<int>& queryblocks(int type, const SDL_Rect& rect);
+
     bool checktowerspikes(int t);
 
     bool checkwall(const SDL_Rect& temprect, const float dx, const float dy, const float dr, const bool skipblocks, const bool skipdirblocks);
@@ -168,6 +175,8 @@ public:
 
     void entitycollisioncheck(void);
 
+    void collisioncandidates(int i);
+
     void collisioncheck(int i, int j, bool scm = false);
 
     void stuckprevention(int t);
@@ -175,10 +184,36 @@ public:
 
     std::vector<entclass> entities;
 
+    /* Slots disableentity() has freed, as a min-heap so createentity()
+     * still reuses the lowest one. Can hold stale indices, so each one is
+     * checked again when it's taken off. */
+    std::vector<int> freeentities;
+    /* The most entity slots in use at once since init(). Headless runs
+     * report it, to show whether entities_reserve is enough. */
+    size_t entities_highwater;
+    static const int entities_reserve = 256;
+
     int k;
 
 
     std::vector<blockclass> blocks;
+
+    /* Indices of the blocks of each type, sorted, by which cells of a grid
+     * over the room they touch. Blocks off the room go in the edge cells. */
+    static const int numblocktypes = ACTIVITY + 1;
+    static const int blockgrid_w = 8;
+    static const int blockgrid_h = 6;
+    static const int blockgrid_cell = 40;
+    std::vector<int> blockgrid[numblocktypes][blockgrid_w * blockgrid_h];
+    std::vector<int> blockquery;
+
+    /* Broad phase for entitycollisioncheck(): (left edge, index) of the
+     * entities that have to overlap a person to do anything, sorted, and
+     * the line entities, which are always checked */
+    std::vector<std::pair<int, int> > collisionsweep;
+    int collisionsweep_maxw;
+    std::vector<int> collisionlines;
+    std::vector<int> collisionpairs;
     bool flags[100];
     bool collect[100];
     bool customcollect[100];
@@ -36,6 +36,10 @@ static int mkdir(char* path, int mode)
 
 static bool isInit = false;
 
+/* Saves and deletes succeed without touching the disk, so a headless run
+ * can't overwrite the player's saves and settings */
+static bool readOnly = false;
+
 static const char* pathSep = NULL;
 static char* basePath = NULL;
 static char saveDir[MAX_PATH] = {'\0'};
@@ -191,6 +195,11 @@ bool FILESYSTEM_isInit(void)
     return isInit;
 }
 
+void FILESYSTEM_setReadOnly(const bool readonly)
+{
+    readOnly = readonly;
+}
+
 static unsigned char* stdin_buffer = NULL;
 static size_t stdin_length = 0;
 
@@ -757,6 +766,11 @@ bool FILESYSTEM_saveTiXml2Document(const char *name, tinyxml2::XMLDocument& doc,
         return false;
     }
 
+    if (readOnly)
+    {
+        return true;
+    }
+
     /* XMLDocument.SaveFile doesn't account for Unicode paths, PHYSFS does */
     tinyxml2::XMLPrinter printer;
     doc.Print(&printer);
@@ -931,6 +945,10 @@ bool FILESYSTEM_openDirectory(const char *dname)
 
 bool FILESYSTEM_delete(const char *name)
 {
+    if (readOnly)
+    {
+        return true;
+    }
     return PHYSFS_delete(name) != 0;
 }
 
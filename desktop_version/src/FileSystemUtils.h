@@ -11,6 +11,7 @@ namespace tinyxml2 { class XMLDocument; }
 
 int FILESYSTEM_init(char *argvZero, char* baseDir, char* assetsPath);
 bool FILESYSTEM_isInit(void);
+void FILESYSTEM_setReadOnly(bool readonly);
 void FILESYSTEM_deinit(void);
 
 char *FILESYSTEM_getUserSaveDirectory(void);
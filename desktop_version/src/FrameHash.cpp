@@ -0,0 +1,372 @@
+#include "FrameHash.h"
+
+#include <SDL.h>
+#include <stdio.h>
+
+#include "Entity.h"
+#include "Game.h"
+#include "Map.h"
+#include "UtilityClass.h"
+#include "Vlogging.h"
+#include "Xoshiro.h"
+
+/* Each record is the frame number followed by one hash per field, all
+ * little-endian Uint32s. Every field gets its own hash, so a divergence names
+ * the field that changed first, not just that something did. Entity fields
+ * are hashed over all entities, in order. */
+#define ENTITY_FIELDS \
+    X(hashint, xp) \
+    X(hashint, yp) \
+    X(hashint, oldxp) \
+    X(hashint, oldyp) \
+    X(hashfloat, newxp) \
+    X(hashfloat, newyp) \
+    X(hashint, cx) \
+    X(hashint, cy) \
+    X(hashint, w) \
+    X(hashint, h) \
+    X(hashfloat, vx) \
+    X(hashfloat, vy) \
+    X(hashfloat, ax) \
+    X(hashfloat, ay) \
+    X(hashint, rule) \
+    X(hashint, type) \
+    X(hashint, invis) \
+    X(hashint, isplatform) \
+    X(hashint, harmful) \
+    X(hashint, size) \
+    X(hashint, tile) \
+    X(hashint, state) \
+    X(hashint, statedelay) \
+    X(hashint, behave) \
+    X(hashint, animate) \
+    X(hashfloat, para) \
+    X(hashint, life) \
+    X(hashint, colour) \
+    X(hashint, x1) \
+    X(hashint, y1) \
+    X(hashint, x2) \
+    X(hashint, y2) \
+    X(hashint, onentity) \
+    X(hashint, onwall) \
+    X(hashint, onxwall) \
+    X(hashint, onywall) \
+    X(hashint, gravity) \
+    X(hashint, onground) \
+    X(hashint, onroof) \
+    X(hashint, dir) \
+    X(hashint, actionframe) \
+    X(hashint, framedelay) \
+    X(hashint, drawframe) \
+    X(hashint, walkingframe)
+
+#define GAME_FIELDS \
+    X(gamestate) \
+    X(state) \
+    X(statedelay) \
+    X(roomx) \
+    X(roomy) \
+    X(gravitycontrol) \
+    X(hascontrol) \
+    X(deathseq) \
+    X(lifeseq) \
+    X(deathcounts)
+
+enum FrameHashField
+{
+    FrameHash_entitycount,
+#define X(HASH, FIELD) FrameHash_entity_##FIELD,
+    ENTITY_FIELDS
+#undef X
+    FrameHash_blocks,
+#define X(FIELD) FrameHash_game_##FIELD,
+    GAME_FIELDS
+#undef X
+    FrameHash_mapcontents,
+    FrameHash_maptowermode,
+    FrameHash_mapypos,
+    FrameHash_rng,
+    FrameHash_NUMFIELDS
+};
+
+static const char* const fieldnames[FrameHash_NUMFIELDS] = {
+    "entity count",
+#define X(HASH, FIELD) "entity " #FIELD,
+    ENTITY_FIELDS
+#undef X
+    "blocks",
+#define X(FIELD) "game." #FIELD,
+    GAME_FIELDS
+#undef X
+    "map.contents",
+    "map.towermode",
+    "map.ypos",
+    "RNG state"
+};
+
+static const char magic[8] = {'V', 'V', 'V', 'F', 'H', 'A', 'S', 'H'};
+static const Uint32 version = 2;
+
+static FILE* outfile = NULL;
+static Uint32 framenum = 0;
+
+/* Little-endian bytes, so it's the same on every platform */
+static void hashint(Uint32* hash, const Uint32 value)
+{
+    const Uint8 bytes[4] = {
+        (Uint8) value,
+        (Uint8) (value >> 8),
+        (Uint8) (value >> 16),
+        (Uint8) (value >> 24)
+    };
+    *hash = fnv1a(*hash, bytes, sizeof(bytes));
+}
+
+SDL_COMPILE_TIME_ASSERT(float_size, sizeof(float) == sizeof(Uint32));
+
+static void hashfloat(Uint32* hash, const float value)
+{
+    Uint32 bits;
+    SDL_memcpy(&bits, &value, sizeof(bits));
+    hashint(hash, bits);
+}
+
+static void hashstring(Uint32* hash, const std::string& value)
+{
+    hashint(hash, value.size());
+    for (size_t i = 0; i < value.size(); i++)
+    {
+        hashint(hash, (unsigned char) value[i]);
+    }
+}
+
+static void hashstate(Uint32 hashes[FrameHash_NUMFIELDS])
+{
+    for (int i = 0; i < FrameHash_NUMFIELDS; i++)
+    {
+        hashes[i] = FNV1A_BASIS;
+    }
+
+    hashint(&hashes[FrameHash_entitycount], obj.entities.size());
+    for (size_t i = 0; i < obj.entities.size(); i++)
+    {
+        const entclass& entity = obj.entities[i];
+#define X(HASH, FIELD) HASH(&hashes[FrameHash_entity_##FIELD], entity.FIELD);
+        ENTITY_FIELDS
+#undef X
+    }
+
+    Uint32* hash = &hashes[FrameHash_blocks];
+    hashint(hash, obj.blocks.size());
+    for (size_t i = 0; i < obj.blocks.size(); i++)
+    {
+        const blockclass& block = obj.blocks[i];
+        hashint(hash, block.type);
+        hashint(hash, block.trigger);
+        hashint(hash, block.rect.x);
+        hashint(hash, block.rect.y);
+        hashint(hash, block.rect.w);
+        hashint(hash, block.rect.h);
+        hashstring(hash, block.script);
+    }
+
+#define X(FIELD) hashint(&hashes[FrameHash_game_##FIELD], game.FIELD);
+    GAME_FIELDS
+#undef X
+
+    hash = &hashes[FrameHash_mapcontents];
+    for (size_t i = 0; i < SDL_arraysize(map.contents); i++)
+    {
+        hashint(hash, map.contents[i]);
+    }
+    hashint(&hashes[FrameHash_maptowermode], map.towermode);
+    hashint(&hashes[FrameHash_mapypos], map.ypos);
+
+    Uint32 rngstate[4];
+    xoshiro_getstate(rngstate);
+    hash = &hashes[FrameHash_rng];
+    for (size_t i = 0; i < SDL_arraysize(rngstate); i++)
+    {
+        hashint(hash, rngstate[i]);
+    }
+}
+
+static bool writeint(FILE* file, const Uint32 value)
+{
+    const Uint32 le = SDL_SwapLE32(value);
+    return fwrite(&le, sizeof(le), 1, file) == 1;
+}
+
+static bool readint(FILE* file, Uint32* value)
+{
+    Uint32 le;
+    if (fread(&le, sizeof(le), 1, file) != 1)
+    {
+        return false;
+    }
+    *value = SDL_SwapLE32(le);
+    return true;
+}
+
+bool FRAMEHASH_open(const char* path)
+{
+    FRAMEHASH_close();
+
+    outfile = fopen(path, "wb");
+    if (outfile == NULL)
+    {
+        vlog_error("Unable to open %s for frame hashes", path);
+        return false;
+    }
+
+    framenum = 0;
+
+    if (fwrite(magic, sizeof(magic), 1, outfile) != 1
+    || !writeint(outfile, version)
+    || !writeint(outfile, FrameHash_NUMFIELDS))
+    {
+        vlog_error("Unable to write frame hash header to %s", path);
+        FRAMEHASH_close();
+        return false;
+    }
+
+    return true;
+}
+
+void FRAMEHASH_close(void)
+{
+    if (outfile != NULL)
+    {
+        fclose(outfile);
+        outfile = NULL;
+    }
+}
+
+void FRAMEHASH_record(void)
+{
+    if (outfile == NULL)
+    {
+        return;
+    }
+
+    Uint32 hashes[FrameHash_NUMFIELDS];
+    hashstate(hashes);
+
+    bool success = writeint(outfile, framenum);
+    for (int i = 0; i < FrameHash_NUMFIELDS; i++)
+    {
+        success = success && writeint(outfile, hashes[i]);
+    }
+
+    if (!success)
+    {
+        vlog_error("Unable to write frame hash for frame %u, stopping", framenum);
+        FRAMEHASH_close();
+        return;
+    }
+
+    framenum++;
+}
+
+static FILE* openhashes(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        vlog_error("Unable to open %s", path);
+        return NULL;
+    }
+
+    char filemagic[sizeof(magic)];
+    Uint32 fileversion;
+    Uint32 numfields;
+    if (fread(filemagic, sizeof(filemagic), 1, file) != 1
+    || SDL_memcmp(filemagic, magic, sizeof(magic)) != 0
+    || !readint(file, &fileversion)
+    || fileversion != version
+    || !readint(file, &numfields)
+    || numfields != FrameHash_NUMFIELDS)
+    {
+        vlog_error("%s is not a version %u frame hash file", path, version);
+        fclose(file);
+        return NULL;
+    }
+
+    return file;
+}
+
+int FRAMEHASH_compare(const char* path_a, const char* path_b)
+{
+    FILE* file_a = openhashes(path_a);
+    FILE* file_b = openhashes(path_b);
+    int result = 1;
+
+    if (file_a == NULL || file_b == NULL)
+    {
+        goto end;
+    }
+
+    while (true)
+    {
+        Uint32 frame_a;
+        Uint32 frame_b;
+        const bool ended_a = !readint(file_a, &frame_a);
+        const bool ended_b = !readint(file_b, &frame_b);
+
+        if (ended_a && ended_b)
+        {
+            vlog_info("Frame hashes match");
+            result = 0;
+            goto end;
+        }
+        if (ended_a || ended_b)
+        {
+            vlog_info(
+                "%s has no frame %u, the other run keeps going",
+                ended_a ? path_a : path_b,
+                ended_a ? frame_b : frame_a
+            );
+            goto end;
+        }
+
+        Uint32 hashes_a[FrameHash_NUMFIELDS];
+        Uint32 hashes_b[FrameHash_NUMFIELDS];
+        for (int i = 0; i < FrameHash_NUMFIELDS; i++)
+        {
+            if (!readint(file_a, &hashes_a[i]) || !readint(file_b, &hashes_b[i]))
+            {
+                vlog_error("Frame %u is cut short", frame_a);
+                goto end;
+            }
+        }
+
+        bool diverged = false;
+        for (int i = 0; i < FrameHash_NUMFIELDS; i++)
+        {
+            if (hashes_a[i] != hashes_b[i])
+            {
+                if (!diverged)
+                {
+                    vlog_info("First divergence at frame %u", frame_a);
+                    diverged = true;
+                }
+                vlog_info("  Mismatch in %s", fieldnames[i]);
+            }
+        }
+        if (diverged)
+        {
+            goto end;
+        }
+    }
+
+end:
+    if (file_a != NULL)
+    {
+        fclose(file_a);
+    }
+    if (file_b != NULL)
+    {
+        fclose(file_b);
+    }
+    return result;
+}
@@ -0,0 +1,16 @@
+#ifndef FRAMEHASH_H
+#define FRAMEHASH_H
+
+/* Hashes the simulation state after every gamelogic() and streams the hashes
+ * to a file, so two runs of the same replay can be checked frame by frame. */
+
+bool FRAMEHASH_open(const char* path);
+
+void FRAMEHASH_close(void);
+
+void FRAMEHASH_record(void);
+
+/* Returns 0 if both files match, 1 if they diverge or can't be read */
+int FRAMEHASH_compare(const char* path_a, const char* path_b);
+
+#endif /* FRAMEHASH_H */
@@ -151,28 +151,22 @@ void Graphics::init(void)
 
     SDL_zeroa(error);
     SDL_zeroa(error_title);
+
+    font_mapped = false;
 }
 
 void Graphics::destroy(void)
 {
-    #define CLEAR_ARRAY(name) \
-        for (size_t i = 0; i < name.size(); i += 1) \
-        { \
-            SDL_FreeSurface(name[i]); \
-        } \
-        name.clear();
-
-    CLEAR_ARRAY(tiles)
-    CLEAR_ARRAY(tiles2)
-    CLEAR_ARRAY(tiles3)
-    CLEAR_ARRAY(entcolours)
-    CLEAR_ARRAY(sprites)
-    CLEAR_ARRAY(flipsprites)
-    CLEAR_ARRAY(tele)
-    CLEAR_ARRAY(bfont)
-    CLEAR_ARRAY(flipbfont)
+    FreeTileSheet(&tiles);
+    FreeTileSheet(&tiles2);
+    FreeTileSheet(&tiles3);
+    FreeTileSheet(&entcolours);
+    FreeTileSheet(&sprites);
+    FreeTileSheet(&flipsprites);
+    FreeTileSheet(&tele);
+    FreeTileSheet(&bfont);
 
-    #undef CLEAR_ARRAY
+    cleartintedtiles();
 }
 
 void Graphics::create_buffers(const SDL_PixelFormat* fmt)
@@ -211,15 +205,9 @@ void Graphics::create_buffers(const SDL_PixelFormat* fmt)
     towerbg.buffer =  CREATE_SURFACE(320 + 16, 240 + 16);
     SDL_SetSurfaceBlendMode(towerbg.buffer, SDL_BLENDMODE_NONE);
 
-    towerbg.buffer_lerp = CREATE_SURFACE(320 + 16, 240 + 16);
-    SDL_SetSurfaceBlendMode(towerbg.buffer_lerp, SDL_BLENDMODE_NONE);
-
     titlebg.buffer = CREATE_SURFACE(320 + 16, 240 + 16);
     SDL_SetSurfaceBlendMode(titlebg.buffer, SDL_BLENDMODE_NONE);
 
-    titlebg.buffer_lerp = CREATE_SURFACE(320 + 16, 240 + 16);
-    SDL_SetSurfaceBlendMode(titlebg.buffer_lerp, SDL_BLENDMODE_NONE);
-
     tempBuffer = CREATE_SURFACE(320, 240);
     SDL_SetSurfaceBlendMode(tempBuffer, SDL_BLENDMODE_NONE);
 
@@ -240,9 +228,7 @@ void Graphics::destroy_buffers(void)
     FREE_SURFACE(warpbuffer)
     FREE_SURFACE(warpbuffer_lerp)
     FREE_SURFACE(towerbg.buffer)
-    FREE_SURFACE(towerbg.buffer_lerp)
     FREE_SURFACE(titlebg.buffer)
-    FREE_SURFACE(titlebg.buffer_lerp)
     FREE_SURFACE(tempBuffer)
 
 #undef FREE_SURFACE
@@ -250,19 +236,18 @@ void Graphics::destroy_buffers(void)
 
 int Graphics::font_idx(uint32_t ch)
 {
-    if (font_positions.size() > 0)
+    if (font_mapped)
     {
-        std::map<int, int>::iterator iter = font_positions.find(ch);
-        if (iter == font_positions.end())
+        int idx = font_glyph(ch);
+        if (idx == -1)
         {
-            iter = font_positions.find('?');
-            if (iter == font_positions.end())
+            idx = font_glyph('?');
+            if (idx == -1)
             {
                 WHINE_ONCE("font.txt missing fallback character!");
-                return -1;
             }
         }
-        return iter->second;
+        return idx;
     }
     else
     {
@@ -270,6 +255,59 @@ int Graphics::font_idx(uint32_t ch)
     }
 }
 
+static SDL_INLINE size_t font_hash_slot(const uint32_t ch, const size_t mask)
+{
+    return (ch * 0x9E3779B1u) & mask;
+}
+
+int Graphics::font_glyph(uint32_t ch)
+{
+    if (ch < (uint32_t) font_dense_size)
+    {
+        return font_dense[ch];
+    }
+
+    if (font_hash.empty())
+    {
+        return -1;
+    }
+
+    const size_t mask = font_hash.size() - 1;
+    for (size_t i = font_hash_slot(ch, mask); ; i = (i + 1) & mask)
+    {
+        if (font_hash[i].glyph == -1 || font_hash[i].codepoint == ch)
+        {
+            return font_hash[i].glyph;
+        }
+    }
+}
+
+/* font_hash has to have been sized beforehand; it never grows here. */
+void Graphics::font_addglyph(uint32_t ch, int glyph)
+{
+    if (ch < (uint32_t) font_dense_size)
+    {
+        font_dense[ch] = glyph;
+        return;
+    }
+
+    if (font_hash.empty())
+    {
+        return;
+    }
+
+    const size_t mask = font_hash.size() - 1;
+    for (size_t i = font_hash_slot(ch, mask); ; i = (i + 1) & mask)
+    {
+        if (font_hash[i].glyph == -1 || font_hash[i].codepoint == ch)
+        {
+            font_hash[i].codepoint = ch;
+            font_hash[i].glyph = glyph;
+            return;
+        }
+    }
+}
+
 void Graphics::drawspritesetcol(int x, int y, int t, int c)
 {
     if (!INBOUNDS_VEC(t, sprites))
@@ -280,7 +318,7 @@ void Graphics::drawspritesetcol(int x, int y, int t, int c)
     setRect(rect,x,y,sprites_rect.w,sprites_rect.h);
     setcol(c);
 
-    BlitSurfaceColoured(sprites[t],NULL,backBuffer, &rect, ct);
+    BlitSurfaceColoured(sprites.surface, &sprites.rects[t], backBuffer, &rect, ct);
 }
 
 void Graphics::updatetitlecolours(void)
@@ -325,42 +363,30 @@ void Graphics::updatetitlecolours(void)
         return false; \
     }
 
-#define PROCESS_TILESHEET_RENAME(tilesheet, vector, tile_square, extra_code) \
+#define PROCESS_TILESHEET_RENAME(tilesheet, sheet, tile_square) \
     PROCESS_TILESHEET_CHECK_ERROR(tilesheet, tile_square) \
     \
     else \
     { \
-        int j; \
-        for (j = 0; j < grphx.im_##tilesheet->h / tile_square; ++j) \
-        { \
-            int i; \
-            for (i = 0; i < grphx.im_##tilesheet->w / tile_square; ++i) \
-            { \
-                SDL_Surface* temp = GetSubSurface( \
-                    grphx.im_##tilesheet, \
-                    i * tile_square, j * tile_square, \
-                    tile_square, tile_square \
-                ); \
-                vector.push_back(temp); \
-                \
-                extra_code \
-            } \
-        } \
+        MakeTileSheet(&sheet, grphx.im_##tilesheet, tile_square); \
         \
         SDL_FreeSurface(grphx.im_##tilesheet); \
         grphx.im_##tilesheet = NULL; \
     }
 
-#define PROCESS_TILESHEET(tilesheet, tile_square, extra_code) \
-    PROCESS_TILESHEET_RENAME(tilesheet, tilesheet, tile_square, extra_code)
+#define PROCESS_TILESHEET(tilesheet, tile_square) \
+    PROCESS_TILESHEET_RENAME(tilesheet, tilesheet, tile_square)
 
 bool Graphics::Makebfont(void)
 {
-    PROCESS_TILESHEET(bfont, 8,
+    PROCESS_TILESHEET(bfont, 8)
+
+    font_mapped = false;
+    for (int i = 0; i < font_dense_size; i++)
     {
-        SDL_Surface* TempFlipped = FlipSurfaceVerticle(temp);
-        flipbfont.push_back(TempFlipped);
-    })
+        font_dense[i] = -1;
+    }
+    font_hash.clear();
 
     unsigned char* charmap;
     size_t length;
@@ -370,17 +396,26 @@ bool Graphics::Makebfont(void)
         unsigned char* current = charmap;
         unsigned char* end = charmap + length;
         int pos = 0;
+
+        /* There can't be more codepoints than bytes, so this keeps the
+         * hash at most half full without ever having to rehash. */
+        size_t capacity = 16;
+        while (capacity < length * 2)
+        {
+            capacity *= 2;
+        }
+        const FontHashEntry empty = {0, -1};
+        font_hash.assign(capacity, empty);
+
         while (current != end)
         {
             int codepoint = utf8::unchecked::next(current);
-            font_positions[codepoint] = pos;
+            font_addglyph(codepoint, pos);
             ++pos;
         }
         FILESYSTEM_freeMemory(&charmap);
-    }
-    else
-    {
-        font_positions.clear();
+        /* An empty font.txt maps nothing, same as a missing one */
+        font_mapped = pos > 0;
     }
 
     return true;
@@ -400,25 +435,28 @@ int Graphics::bfontlen(uint32_t ch)
 
 bool Graphics::MakeTileArray(void)
 {
-    PROCESS_TILESHEET(tiles, 8, {})
-    PROCESS_TILESHEET(tiles2, 8, {})
-    PROCESS_TILESHEET(tiles3, 8, {})
-    PROCESS_TILESHEET(entcolours, 8, {})
+    PROCESS_TILESHEET(tiles, 8)
+    PROCESS_TILESHEET(tiles2, 8)
+    PROCESS_TILESHEET(tiles3, 8)
+    PROCESS_TILESHEET(entcolours, 8)
 
     return true;
 }
 
 bool Graphics::maketelearray(void)
 {
-    PROCESS_TILESHEET_RENAME(teleporter, tele, 96, {})
+    PROCESS_TILESHEET_RENAME(teleporter, tele, 96)
 
     return true;
 }
 
 bool Graphics::MakeSpriteArray(void)
 {
-    PROCESS_TILESHEET(sprites, 32, {})
-    PROCESS_TILESHEET(flipsprites, 32, {})
+    PROCESS_TILESHEET(sprites, 32)
+    PROCESS_TILESHEET(flipsprites, 32)
+
+    MakeTileSheetMasks(&sprites);
+    MakeTileSheetMasks(&flipsprites);
 
     return true;
 }
@@ -474,38 +512,6 @@ void Graphics::map_option(int opt, int num_opts, const std::string& text, bool s
     }
 }
 
-static void print_char(
-    SDL_Surface* const buffer,
-    SDL_Surface* const font,
-    const int x,
-    const int y,
-    const int scale,
-    colourTransform& ct
-) {
-    SDL_Rect font_rect = {x, y, 8*scale, 8*scale};
-    SDL_Surface* surface;
-
-    if (scale > 1)
-    {
-        surface = ScaleSurface(font, 8 * scale, 8 * scale);
-        if (surface == NULL)
-        {
-            return;
-        }
-    }
-    else
-    {
-        surface = font;
-    }
-
-    BlitSurfaceColoured(surface, NULL, buffer, &font_rect, ct);
-
-    if (scale > 1)
-    {
-        SDL_FreeSurface(surface);
-    }
-}
-
 void Graphics::do_print(
     const int x,
     const int y,
@@ -516,11 +522,23 @@ void Graphics::do_print(
     int a,
     const int scale
 ) {
-    std::vector<SDL_Surface*>& font = flipmode ? flipbfont : bfont;
+    const TileSheet& font = bfont;
+
+    /* Glyphs are queued up and handed over to the blitter a batch at a
+     * time, all straight out of the sheet. In flip mode the blitter reads
+     * each glyph upside down, so there's no flipped copy of the font. */
+    SDL_Rect glyphs[64];
+    SDL_Point positions[64];
+    int count = 0;
 
     int position = 0;
     std::string::const_iterator iter = text.begin();
 
+    if (font.surface == NULL)
+    {
+        return;
+    }
+
     r = SDL_clamp(r, 0, 255);
     g = SDL_clamp(g, 0, 255);
     b = SDL_clamp(b, 0, 255);
@@ -535,11 +553,25 @@ void Graphics::do_print(
 
         if (INBOUNDS_VEC(idx, font))
         {
-            print_char(backBuffer, font[idx], x + position, y, scale, ct);
+            glyphs[count] = font.rects[idx];
+            positions[count].x = x + position;
+            positions[count].y = y;
+            count++;
+
+            if (count == (int) SDL_arraysize(glyphs))
+            {
+                BlitTilesColoured(font.surface, glyphs, positions, count, scale, flipmode, backBuffer, ct);
+                count = 0;
+            }
         }
 
         position += bfontlen(character) * scale;
     }
+
+    if (count > 0)
+    {
+        BlitTilesColoured(font.surface, glyphs, positions, count, scale, flipmode, backBuffer, ct);
+    }
 }
 
 void Graphics::Print( int _x, int _y, const std::string& _s, int r, int g, int b, bool cen /*= false*/ ) {
@@ -636,6 +668,66 @@ bool Graphics::next_wrap_s(
     return retval;
 }
 
+static const size_t max_wraplayouts = 64;
+
+static Uint32 wraplayout_hash(const char* str)
+{
+    return fnv1a(FNV1A_BASIS, str, SDL_strlen(str));
+}
+
+/* The returned lines are only good until the next call. */
+const std::vector<Graphics::WrapLine>& Graphics::wraplayout(
+    const char* str,
+    const int maxwidth
+) {
+    const WrapLayoutKey key(wraplayout_hash(str), maxwidth);
+    std::map<WrapLayoutKey, std::list<WrapLayout>::iterator>::iterator iter =
+        wraplayout_lookup.find(key);
+
+    if (iter != wraplayout_lookup.end())
+    {
+        /* Bump it to the front */
+        wraplayouts.splice(wraplayouts.begin(), wraplayouts, iter->second);
+        if (iter->second->text == str)
+        {
+            return iter->second->lines;
+        }
+        /* Hash collision; lay the new string out over the old one */
+    }
+    else
+    {
+        if (wraplayout_lookup.size() >= max_wraplayouts)
+        {
+            /* Evict the least recently used one */
+            wraplayout_lookup.erase(wraplayouts.back().key);
+            wraplayouts.pop_back();
+        }
+
+        wraplayouts.push_front(WrapLayout());
+        wraplayouts.front().key = key;
+        wraplayout_lookup[key] = wraplayouts.begin();
+    }
+
+    WrapLayout& layout = wraplayouts.front();
+    layout.text = str;
+    layout.lines.clear();
+
+    /* Screen width is 320 pixels. The shortest a char can be is 6 pixels wide.
+     * 320 / 6 is 54, rounded up. 4 bytes per char. */
+    char buffer[54*4 + 1];
+    size_t start = 0;
+
+    while (next_wrap_s(buffer, sizeof(buffer), &start, str, maxwidth))
+    {
+        WrapLine line;
+        line.text = buffer;
+        line.width = len(line.text);
+        layout.lines.push_back(line);
+    }
+
+    return layout.lines;
+}
+
 void Graphics::PrintWrap(
     const int x,
     int y,
@@ -647,26 +739,18 @@ void Graphics::PrintWrap(
     const int linespacing,
     const int maxwidth
 ) {
-    /* Screen width is 320 pixels. The shortest a char can be is 6 pixels wide.
-     * 320 / 6 is 54, rounded up. 4 bytes per char. */
-    char buffer[54*4 + 1];
-    size_t start = 0;
+    const std::vector<WrapLine>& lines = wraplayout(str, maxwidth);
 
     if (flipmode)
     {
         /* Correct for the height of the resulting print. */
-        size_t len = 0;
-        while (next_wrap(&start, &len, &str[start], maxwidth))
-        {
-            y += linespacing;
-        }
-        y -= linespacing;
-        start = 0;
+        y += ((int) lines.size() - 1) * linespacing;
     }
 
-    while (next_wrap_s(buffer, sizeof(buffer), &start, str, maxwidth))
+    for (size_t i = 0; i < lines.size(); ++i)
     {
-        Print(x, y, buffer, r, g, b, cen);
+        const int line_x = cen ? 160 - lines[i].width / 2 : x;
+        do_print(line_x, y, lines[i].text, r, g, b, 255, 1);
 
         if (flipmode)
         {
@@ -839,7 +923,7 @@ void Graphics::drawsprite( int x, int y, int t, int r, int g,  int b )
 
     SDL_Rect rect = {x, y, sprites_rect.w, sprites_rect.h};
     setcolreal(getRGB(r,g,b));
-    BlitSurfaceColoured(sprites[t], NULL, backBuffer, &rect, ct);
+    BlitSurfaceColoured(sprites.surface, &sprites.rects[t], backBuffer, &rect, ct);
 }
 
 void Graphics::drawsprite(int x, int y, int t, Uint32 c)
@@ -852,7 +936,7 @@ void Graphics::drawsprite(int x, int y, int t, Uint32 c)
 
     SDL_Rect rect = {x, y, sprites_rect.w, sprites_rect.h};
     setcolreal(c);
-    BlitSurfaceColoured(sprites[t], NULL, backBuffer, &rect, ct);
+    BlitSurfaceColoured(sprites.surface, &sprites.rects[t], backBuffer, &rect, ct);
 }
 
 #ifndef NO_CUSTOM_LEVELS
@@ -877,13 +961,12 @@ void Graphics::drawtile( int x, int y, int t )
 #if !defined(NO_CUSTOM_LEVELS)
     if (shouldrecoloroneway(t, tiles1_mounted))
     {
-        colourTransform thect = {cl.getonewaycol()};
-        BlitSurfaceTinted(tiles[t], NULL, backBuffer, &rect, thect);
+        drawtintedtile(tiles, t, cl.getonewaycol(), backBuffer, &rect);
     }
     else
 #endif
     {
-        BlitSurfaceStandard(tiles[t], NULL, backBuffer, &rect);
+        BlitSurfaceStandard(tiles.surface, &tiles.rects[t], backBuffer, &rect);
     }
 }
 
@@ -901,18 +984,75 @@ void Graphics::drawtile2( int x, int y, int t )
 #if !defined(NO_CUSTOM_LEVELS)
     if (shouldrecoloroneway(t, tiles2_mounted))
     {
-        colourTransform thect = {cl.getonewaycol()};
-        BlitSurfaceTinted(tiles2[t], NULL, backBuffer, &rect, thect);
+        drawtintedtile(tiles2, t, cl.getonewaycol(), backBuffer, &rect);
     }
     else
 #endif
     {
-        BlitSurfaceStandard(tiles2[t], NULL, backBuffer, &rect);
+        BlitSurfaceStandard(tiles2.surface, &tiles2.rects[t], backBuffer, &rect);
     }
 }
 
 
 
+static const size_t max_tintedtiles = 512;
+
+void Graphics::drawtintedtile(
+    TileSheet& sheet,
+    const int t,
+    const Uint32 colour,
+    SDL_Surface* dest,
+    SDL_Rect* rect
+) {
+    const TintedTileKey key(std::make_pair(sheet.surface, t), colour);
+    std::map<TintedTileKey, std::list<TintedTile>::iterator>::iterator iter =
+        tintedtile_lookup.find(key);
+
+    if (iter != tintedtile_lookup.end())
+    {
+        /* Bump it to the front */
+        tintedtiles.splice(tintedtiles.begin(), tintedtiles, iter->second);
+        BlitSurfaceStandard(iter->second->surface, NULL, dest, rect);
+        return;
+    }
+
+    colourTransform thect = {colour};
+    SDL_Surface* tile = CopySubSurface(sheet.surface, &sheet.rects[t]);
+    TintedTile tinted;
+    tinted.key = key;
+    tinted.surface = tile != NULL ? TintSurface(tile, thect) : NULL;
+    SDL_FreeSurface(tile);
+    if (tinted.surface == NULL)
+    {
+        BlitSurfaceTinted(sheet.surface, &sheet.rects[t], dest, rect, thect);
+        return;
+    }
+
+    if (tintedtile_lookup.size() >= max_tintedtiles)
+    {
+        /* Evict the least recently used one */
+        SDL_FreeSurface(tintedtiles.back().surface);
+        tintedtile_lookup.erase(tintedtiles.back().key);
+        tintedtiles.pop_back();
+    }
+
+    tintedtiles.push_front(tinted);
+    tintedtile_lookup[key] = tintedtiles.begin();
+
+    BlitSurfaceStandard(tinted.surface, NULL, dest, rect);
+}
+
+void Graphics::cleartintedtiles(void)
+{
+    std::list<TintedTile>::iterator iter;
+    for (iter = tintedtiles.begin(); iter != tintedtiles.end(); ++iter)
+    {
+        SDL_FreeSurface(iter->surface);
+    }
+    tintedtiles.clear();
+    tintedtile_lookup.clear();
+}
+
 void Graphics::drawtile3( int x, int y, int t, int off, int height_subtract /*= 0*/ )
 {
     t += off * 30;
@@ -921,9 +1061,10 @@ void Graphics::drawtile3( int x, int y, int t, int off, int height_subtract /*=
         WHINE_ONCE("drawtile3() out-of-bounds!");
         return;
     }
-    SDL_Rect src_rect = { 0, 0, tiles_rect.w, tiles_rect.h - height_subtract };
+    SDL_Rect src_rect = tiles3.rects[t];
+    src_rect.h -= height_subtract;
     SDL_Rect rect = {x, y, tiles_rect.w, tiles_rect.h};
-    BlitSurfaceStandard(tiles3[t], &src_rect, backBuffer, &rect);
+    BlitSurfaceStandard(tiles3.surface, &src_rect, backBuffer, &rect);
 }
 
 void Graphics::drawtowertile( int x, int y, int t )
@@ -936,7 +1077,7 @@ void Graphics::drawtowertile( int x, int y, int t )
     x += 8;
     y += 8;
     SDL_Rect rect = {x, y, tiles_rect.w, tiles_rect.h};
-    BlitSurfaceStandard(tiles2[t], NULL, warpbuffer, &rect);
+    BlitSurfaceStandard(tiles2.surface, &tiles2.rects[t], warpbuffer, &rect);
 }
 
 
@@ -951,7 +1092,7 @@ void Graphics::drawtowertile3( int x, int y, int t, TowerBG& bg_obj )
     x += 8;
     y += 8;
     SDL_Rect rect = {x, y, tiles_rect.w, tiles_rect.h};
-    BlitSurfaceStandard(tiles3[t], NULL, bg_obj.buffer, &rect);
+    BlitSurfaceToRing(tiles3.surface, &tiles3.rects[t], bg_obj.buffer, bg_obj.buffer_origin, &rect);
 }
 
 void Graphics::drawgui(void)
@@ -1621,27 +1762,31 @@ void Graphics::drawcoloredtile(
 
     setcolreal(getRGB(r, g, b));
     setRect(rect, x, y, tiles_rect.w, tiles_rect.h);
-    BlitSurfaceColoured(tiles[t], NULL, backBuffer, &rect, ct);
+    BlitSurfaceColoured(tiles.surface, &tiles.rects[t], backBuffer, &rect, ct);
 }
 
 
-bool Graphics::Hitest(SDL_Surface* surface1, point p1, SDL_Surface* surface2, point p2)
+/* Hitest() one pixel at a time, for sheets that have no masks */
+static bool HitestPixels(TileSheet& sheet, const int frame1, point p1, const int frame2, point p2)
 {
+    SDL_Surface* surface = sheet.surface;
+    const SDL_Rect& frame_rect1 = sheet.rects[frame1];
+    const SDL_Rect& frame_rect2 = sheet.rects[frame2];
 
     //find rectangle where they intersect:
 
     int r1_left = p1.x;
-    int r1_right = r1_left + surface1->w;
+    int r1_right = r1_left + frame_rect1.w;
     int r2_left = p2.x;
-    int r2_right = r2_left + surface2->w;
+    int r2_right = r2_left + frame_rect2.w;
 
     int r1_bottom = p1.y;
-    int r1_top = p1.y + surface1->h;
+    int r1_top = p1.y + frame_rect1.h;
     int r2_bottom  = p2.y;
-    int r2_top = p2.y + surface2->h;
+    int r2_top = p2.y + frame_rect2.h;
 
-    SDL_Rect rect1 = {p1.x, p1.y, surface1->w, surface1->h};
-    SDL_Rect rect2 = {p2.x, p2.y, surface2->w, surface2->h};
+    SDL_Rect rect1 = {p1.x, p1.y, frame_rect1.w, frame_rect1.h};
+    SDL_Rect rect2 = {p2.x, p2.y, frame_rect2.w, frame_rect2.h};
     bool intersection = help.intersects(rect1, rect2);
 
     if(intersection)
@@ -1656,13 +1801,13 @@ bool Graphics::Hitest(SDL_Surface* surface1, point p1, SDL_Surface* surface2, po
         {
             for(int y = r3_bottom; y < r3_top; y++)
             {
-                Uint32 pixel1 = ReadPixel(surface1 , x - p1.x, y - p1.y);
-                Uint32 pixel2 = ReadPixel(surface2 , x - p2.x, y - p2.y);
+                Uint32 pixel1 = ReadPixel(surface, frame_rect1.x + x - p1.x, frame_rect1.y + y - p1.y);
+                Uint32 pixel2 = ReadPixel(surface, frame_rect2.x + x - p2.x, frame_rect2.y + y - p2.y);
                 /* INTENTIONAL BUG! In previous versions, the game mistakenly
                  * checked the red channel, not the alpha channel.
                  * We preserve it here because some people abuse this. */
-                if ((pixel1 & surface1->format->Rmask)
-                && (pixel2 & surface2->format->Rmask))
+                if ((pixel1 & surface->format->Rmask)
+                && (pixel2 & surface->format->Rmask))
                 {
                     return true;
                 }
@@ -1673,6 +1818,47 @@ bool Graphics::Hitest(SDL_Surface* surface1, point p1, SDL_Surface* surface2, po
 
 }
 
+bool Graphics::Hitest(TileSheet& sheet, const int frame1, point p1, const int frame2, point p2)
+{
+    const SDL_Rect& rect1 = sheet.rects[frame1];
+    const SDL_Rect& rect2 = sheet.rects[frame2];
+    const int dx = p2.x - p1.x;
+    const int dy = p2.y - p1.y;
+
+    if (sheet.masks.empty())
+    {
+        /* Tiles too wide for a mask row */
+        return HitestPixels(sheet, frame1, p1, frame2, p2);
+    }
+
+    if (dx <= -rect2.w || dx >= rect1.w
+    || dy <= -rect2.h || dy >= rect1.h)
+    {
+        return false;
+    }
+
+    /* INTENTIONAL BUG! In previous versions, the game mistakenly
+     * checked the red channel, not the alpha channel.
+     * We preserve it here because some people abuse this.
+     * (The masks are built from the red channel; see MakeTileSheetMasks().) */
+    const Uint32* mask1 = &sheet.masks[frame1 * rect1.h];
+    const Uint32* mask2 = &sheet.masks[frame2 * rect2.h];
+    const int top = SDL_max(dy, 0);
+    const int bottom = SDL_min(dy + rect2.h, rect1.h);
+
+    //for every row of the overlap, line sprite 2 up with sprite 1
+    for (int y = top; y < bottom; y++)
+    {
+        const Uint32 row2 = dx >= 0 ? mask2[y - dy] << dx : mask2[y - dy] >> -dx;
+        if (mask1[y] & row2)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void Graphics::drawgravityline( int t )
 {
     if (!INBOUNDS_VEC(t, obj.entities))
@@ -1867,9 +2053,9 @@ void Graphics::drawentity(const int i, const int yoff)
     const bool custom_gray = false;
 #endif
 
-    std::vector<SDL_Surface*>& tilesvec = (map.custommode && !map.finalmode) ? entcolours : tiles;
+    TileSheet& tilesvec = (map.custommode && !map.finalmode) ? entcolours : tiles;
 
-    std::vector<SDL_Surface*>& spritesvec = flipmode ? flipsprites : sprites;
+    TileSheet& spritesvec = flipmode ? flipsprites : sprites;
 
     const int xp = lerp(obj.entities[i].lerpoldxp, obj.entities[i].xp);
     const int yp = lerp(obj.entities[i].lerpoldyp, obj.entities[i].yp);
@@ -1890,7 +2076,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect = sprites_rect;
         drawRect.x += tpoint.x;
         drawRect.y += tpoint.y;
-        BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe], NULL, backBuffer, &drawRect, ct);
+        BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe], backBuffer, &drawRect, ct);
 
         //screenwrapping!
         point wrappedPoint;
@@ -1927,21 +2113,21 @@ void Graphics::drawentity(const int i, const int yoff)
             drawRect = sprites_rect;
             drawRect.x += wrappedPoint.x;
             drawRect.y += tpoint.y;
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe], NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe], backBuffer, &drawRect, ct);
         }
         if (wrapY && map.warpy)
         {
             drawRect = sprites_rect;
             drawRect.x += tpoint.x;
             drawRect.y += wrappedPoint.y;
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe], NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe], backBuffer, &drawRect, ct);
         }
         if (wrapX && wrapY && map.warpx && map.warpy)
         {
             drawRect = sprites_rect;
             drawRect.x += wrappedPoint.x;
             drawRect.y += wrappedPoint.y;
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe], NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe], backBuffer, &drawRect, ct);
         }
         break;
     }
@@ -1956,7 +2142,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect = tiles_rect;
         drawRect.x += tpoint.x;
         drawRect.y += tpoint.y;
-        BlitSurfaceStandard(tiles[obj.entities[i].drawframe],NULL, backBuffer, &drawRect);
+        BlitSurfaceStandard(tiles.surface, &tiles.rects[obj.entities[i].drawframe], backBuffer, &drawRect);
         break;
     case 2:
     case 8:
@@ -1981,13 +2167,11 @@ void Graphics::drawentity(const int i, const int yoff)
             drawRect.x += 8 * ii;
             if (custom_gray)
             {
-                colourTransform temp_ct;
-                temp_ct.colour = 0xFFFFFFFF;
-                BlitSurfaceTinted(tilesvec[obj.entities[i].drawframe],NULL, backBuffer, &drawRect, temp_ct);
+                drawtintedtile(tilesvec, obj.entities[i].drawframe, 0xFFFFFFFF, backBuffer, &drawRect);
             }
             else
             {
-                BlitSurfaceStandard(tilesvec[obj.entities[i].drawframe],NULL, backBuffer, &drawRect);
+                BlitSurfaceStandard(tilesvec.surface, &tilesvec.rects[obj.entities[i].drawframe], backBuffer, &drawRect);
             }
         }
         break;
@@ -2039,7 +2223,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect.y += tpoint.y;
         if (INBOUNDS_VEC(obj.entities[i].drawframe, spritesvec))
         {
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe],NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe], backBuffer, &drawRect, ct);
         }
 
         tpoint.x = xp+32;
@@ -2050,7 +2234,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect.y += tpoint.y;
         if (INBOUNDS_VEC(obj.entities[i].drawframe+1, spritesvec))
         {
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe+1],NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe+1], backBuffer, &drawRect, ct);
         }
 
         tpoint.x = xp;
@@ -2061,7 +2245,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect.y += tpoint.y;
         if (INBOUNDS_VEC(obj.entities[i].drawframe+12, spritesvec))
         {
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe+12],NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe+12], backBuffer, &drawRect, ct);
         }
 
         tpoint.x = xp+32;
@@ -2072,7 +2256,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect.y += tpoint.y;
         if (INBOUNDS_VEC(obj.entities[i].drawframe+13, spritesvec))
         {
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe + 13],NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe + 13], backBuffer, &drawRect, ct);
         }
         break;
     case 10:         // 2x1 Sprite
@@ -2086,7 +2270,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect.y += tpoint.y;
         if (INBOUNDS_VEC(obj.entities[i].drawframe, spritesvec))
         {
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe],NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe], backBuffer, &drawRect, ct);
         }
 
         tpoint.x = xp+32;
@@ -2097,7 +2281,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect.y += tpoint.y;
         if (INBOUNDS_VEC(obj.entities[i].drawframe+1, spritesvec))
         {
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe+1],NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe+1], backBuffer, &drawRect, ct);
         }
         break;
     case 11:    //The fucking elephant
@@ -2114,7 +2298,7 @@ void Graphics::drawentity(const int i, const int yoff)
         drawRect.y += tpoint.y;
         if (INBOUNDS_VEC(obj.entities[i].drawframe, spritesvec))
         {
-            BlitSurfaceColoured(spritesvec[obj.entities[i].drawframe],NULL, backBuffer, &drawRect, ct);
+            BlitSurfaceColoured(spritesvec.surface, &spritesvec.rects[obj.entities[i].drawframe], backBuffer, &drawRect, ct);
         }
 
 
@@ -2139,7 +2323,7 @@ void Graphics::drawentity(const int i, const int yoff)
             drawRect.y += tpoint.y;
             if (INBOUNDS_VEC(1167, tiles))
             {
-                BlitSurfaceColoured(tiles[1167],NULL, backBuffer, &drawRect, ct);
+                BlitSurfaceColoured(tiles.surface, &tiles.rects[1167], backBuffer, &drawRect, ct);
             }
 
         }
@@ -2162,7 +2346,7 @@ void Graphics::drawentity(const int i, const int yoff)
             drawRect.y += tpoint.y;
             if (INBOUNDS_VEC(1166, tiles))
             {
-                BlitSurfaceColoured(tiles[1166],NULL, backBuffer, &drawRect, ct);
+                BlitSurfaceColoured(tiles.surface, &tiles.rects[1166], backBuffer, &drawRect, ct);
             }
         }
         break;
@@ -2176,10 +2360,17 @@ void Graphics::drawentity(const int i, const int yoff)
 
         tpoint.x = xp; tpoint.y = yp - yoff;
         setcolreal(obj.entities[i].realcol);
-        setRect(drawRect, xp, yp - yoff, sprites_rect.x * 6, sprites_rect.y * 6);
-        SDL_Surface* TempSurface = ScaleSurface( spritesvec[obj.entities[i].drawframe], 6 * sprites_rect.w,6* sprites_rect.h );
-        BlitSurfaceColoured(TempSurface, NULL , backBuffer,  &drawRect, ct );
-        SDL_FreeSurface(TempSurface);
+        const SDL_Point position = {xp, yp - yoff};
+        BlitTilesColoured(
+            spritesvec.surface,
+            &spritesvec.rects[obj.entities[i].drawframe],
+            &position,
+            1,
+            6,
+            false,
+            backBuffer,
+            ct
+        );
 
 
 
@@ -2746,9 +2937,13 @@ void Graphics::drawtowerspikes(void)
 void Graphics::drawtowerbackground(const TowerBG& bg_obj)
 {
     ClearSurface(backBuffer);
-    SDL_BlitSurface(bg_obj.buffer, NULL, bg_obj.buffer_lerp, NULL);
-    ScrollSurface(bg_obj.buffer_lerp, 0, lerp(0, -bg_obj.bscroll));
-    SDL_BlitSurface(bg_obj.buffer_lerp, &towerbuffer_rect, backBuffer, NULL);
+    BlitScrolledRing(
+        bg_obj.buffer,
+        bg_obj.buffer_origin,
+        lerp(0, -bg_obj.bscroll),
+        &towerbuffer_rect,
+        backBuffer
+    );
 }
 
 void Graphics::updatetowerbackground(TowerBG& bg_obj)
@@ -2775,7 +2970,7 @@ void Graphics::updatetowerbackground(TowerBG& bg_obj)
     else
     {
         //just update the bottom
-        ScrollSurface(bg_obj.buffer, 0, -bg_obj.bscroll);
+        ScrollRingSurface(bg_obj.buffer, &bg_obj.buffer_origin, -bg_obj.bscroll);
         if (bg_obj.scrolldir == 0)
         {
             for (int i = 0; i < 40; i++)
@@ -3030,7 +3225,7 @@ void Graphics::drawhuetile( int x, int y, int t )
 
     SDL_Rect rect;
     setRect(rect,tpoint.x,tpoint.y,tiles_rect.w, tiles_rect.h);
-    BlitSurfaceColoured(tiles[t],NULL,backBuffer, &rect, ct);
+    BlitSurfaceColoured(tiles.surface, &tiles.rects[t], backBuffer, &rect, ct);
 }
 
 void Graphics::huetilesetcol(int t)
@@ -3246,7 +3441,7 @@ void Graphics::drawtele(int x, int y, int t, Uint32 c)
     setRect(telerect, x , y, tele_rect.w, tele_rect.h );
     if (INBOUNDS_VEC(0, tele))
     {
-        BlitSurfaceColoured(tele[0], NULL, backBuffer, &telerect, ct);
+        BlitSurfaceColoured(tele.surface, &tele.rects[0], backBuffer, &telerect, ct);
     }
 
     setcolreal(c);
@@ -3256,7 +3451,7 @@ void Graphics::drawtele(int x, int y, int t, Uint32 c)
     setRect(telerect, x , y, tele_rect.w, tele_rect.h );
     if (INBOUNDS_VEC(t, tele))
     {
-        BlitSurfaceColoured(tele[t], NULL, backBuffer, &telerect, ct);
+        BlitSurfaceColoured(tele.surface, &tele.rects[t], backBuffer, &telerect, ct);
     }
 }
 
@@ -3302,13 +3497,12 @@ void Graphics::drawforetile(int x, int y, int t)
 #if !defined(NO_CUSTOM_LEVELS)
     if (shouldrecoloroneway(t, tiles1_mounted))
     {
-        colourTransform thect = {cl.getonewaycol()};
-        BlitSurfaceTinted(tiles[t], NULL, foregroundBuffer, &rect, thect);
+        drawtintedtile(tiles, t, cl.getonewaycol(), foregroundBuffer, &rect);
     }
     else
 #endif
     {
-        BlitSurfaceStandard(tiles[t],NULL, foregroundBuffer, &rect  );
+        BlitSurfaceStandard(tiles.surface, &tiles.rects[t], foregroundBuffer, &rect  );
     }
 }
 
@@ -3326,13 +3520,12 @@ void Graphics::drawforetile2(int x, int y, int t)
 #if !defined(NO_CUSTOM_LEVELS)
     if (shouldrecoloroneway(t, tiles2_mounted))
     {
-        colourTransform thect = {cl.getonewaycol()};
-        BlitSurfaceTinted(tiles2[t], NULL, foregroundBuffer, &rect, thect);
+        drawtintedtile(tiles2, t, cl.getonewaycol(), foregroundBuffer, &rect);
     }
     else
 #endif
     {
-        BlitSurfaceStandard(tiles2[t],NULL, foregroundBuffer, &rect  );
+        BlitSurfaceStandard(tiles2.surface, &tiles2.rects[t], foregroundBuffer, &rect  );
     }
 }
 
@@ -3346,7 +3539,7 @@ void Graphics::drawforetile3(int x, int y, int t, int off)
     }
     SDL_Rect rect;
     setRect(rect, x,y,tiles_rect.w, tiles_rect.h);
-    BlitSurfaceStandard(tiles3[t],NULL, foregroundBuffer, &rect  );
+    BlitSurfaceStandard(tiles3.surface, &tiles3.rects[t], foregroundBuffer, &rect  );
 }
 
 void Graphics::drawrect(int x, int y, int w, int h, int r, int g, int b)
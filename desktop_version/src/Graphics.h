@@ -1,6 +1,7 @@
 #ifndef GRAPHICS_H
 #define GRAPHICS_H
 
+#include <list>
 #include <map>
 #include <string>
 #include <vector>
@@ -24,6 +25,8 @@ public:
 
     int bfontlen(uint32_t ch);
     int font_idx(uint32_t ch);
+    int font_glyph(uint32_t ch);
+    void font_addglyph(uint32_t ch, int glyph);
 
     bool Makebfont(void);
 
@@ -140,6 +143,13 @@ public:
 
     bool next_wrap_s(char buffer[], size_t buffer_size, size_t* start, const char* str, int maxwidth);
 
+    struct WrapLine
+    {
+        std::string text;
+        int width;
+    };
+    const std::vector<WrapLine>& wraplayout(const char* str, int maxwidth);
+
     void PrintWrap(int x, int y, const char* str, int r, int g, int b, bool cen, int linespacing, int maxwidth);
 
     void bprint(int x, int y, const std::string& t, int r, int g, int b, bool cen = false);
@@ -164,7 +174,7 @@ public:
     void renderfixedpre(void);
     void renderfixedpost(void);
 
-    bool Hitest(SDL_Surface* surface1, point p1, SDL_Surface* surface2, point p2);
+    bool Hitest(TileSheet& sheet, int frame1, point p1, int frame2, point p2);
 
     void drawentities(void);
 
@@ -194,6 +204,8 @@ public:
 #ifndef NO_CUSTOM_LEVELS
     bool shouldrecoloroneway(const int tilenum, const bool mounted);
 #endif
+    void drawtintedtile(TileSheet& sheet, int t, Uint32 colour, SDL_Surface* dest, SDL_Rect* rect);
+    void cleartintedtiles(void);
     void drawtile3( int x, int y, int t, int off, int height_subtract = 0 );
     void drawtile2( int x, int y, int t );
     void drawtile( int x, int y, int t );
@@ -242,15 +254,40 @@ public:
 
     std::vector <SDL_Surface*> images;
 
-    std::vector <SDL_Surface*> tele;
-    std::vector <SDL_Surface*> tiles;
-    std::vector <SDL_Surface*> tiles2;
-    std::vector <SDL_Surface*> tiles3;
-    std::vector <SDL_Surface*> entcolours;
-    std::vector <SDL_Surface*> sprites;
-    std::vector <SDL_Surface*> flipsprites;
-    std::vector <SDL_Surface*> bfont;
-    std::vector <SDL_Surface*> flipbfont;
+    TileSheet tele;
+    TileSheet tiles;
+    TileSheet tiles2;
+    TileSheet tiles3;
+    TileSheet entcolours;
+    TileSheet sprites;
+    TileSheet flipsprites;
+    TileSheet bfont;
+
+    /* (sheet, tile index), colour */
+    typedef std::pair<std::pair<SDL_Surface*, int>, Uint32> TintedTileKey;
+    struct TintedTile
+    {
+        TintedTileKey key;
+        SDL_Surface* surface;
+    };
+    /* One-way tiles recoloured by BlitSurfaceTinted(), most recently used
+     * first. Keyed on the untinted tile surface, so this has to be cleared
+     * whenever the tile arrays are. */
+    std::list<TintedTile> tintedtiles;
+    std::map<TintedTileKey, std::list<TintedTile>::iterator> tintedtile_lookup;
+
+    /* Line breaks of strings drawn by PrintWrap(), most recently used
+     * first. Keyed on a hash of the text and the wrap width; the text is
+     * kept to check against, in case two strings collide. */
+    typedef std::pair<Uint32, int> WrapLayoutKey;
+    struct WrapLayout
+    {
+        WrapLayoutKey key;
+        std::string text;
+        std::vector<WrapLine> lines;
+    };
+    std::list<WrapLayout> wraplayouts;
+    std::map<WrapLayoutKey, std::list<WrapLayout>::iterator> wraplayout_lookup;
 
     bool flipmode;
     bool setflipmode;
@@ -319,7 +356,18 @@ public:
 
     bool translucentroomname;
 
-    std::map<int, int> font_positions;
+    /* Codepoint to glyph index, from font.txt. Codepoints below
+     * font_dense_size are a straight array lookup, anything above goes
+     * through a small open-addressed hash. Unmapped entries are -1. */
+    static const int font_dense_size = 0x250;
+    struct FontHashEntry
+    {
+        uint32_t codepoint;
+        int glyph;
+    };
+    bool font_mapped;
+    int font_dense[font_dense_size];
+    std::vector<FontHashEntry> font_hash;
 
     SDL_Surface* ghostbuffer;
 
@@ -4,8 +4,20 @@
 #include <stddef.h>
 #include <stdlib.h>
 
+#include "Constants.h"
 #include "Graphics.h"
 #include "Maths.h"
+#include "Vlogging.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define GRAPHICSUTIL_SSE2
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define GRAPHICSUTIL_NEON
+#endif
 
 
 
@@ -118,6 +130,98 @@ static void DrawPixel( SDL_Surface *_surface, int x, int y, Uint32 pixel )
     }
 }
 
+/* Unlike GetSubSurface(), this copies the pixels as they are, instead of
+ * blending them onto a blank surface. */
+SDL_Surface* CopySubSurface( SDL_Surface* metaSurface, const SDL_Rect* area )
+{
+    SDL_Surface* ret = RecreateSurfaceWithDimensions(
+        metaSurface,
+        area->w,
+        area->h
+    );
+    if (ret == NULL)
+    {
+        return NULL;
+    }
+
+    for (int y = 0; y < area->h; y++)
+    {
+        for (int x = 0; x < area->w; x++)
+        {
+            DrawPixel(ret, x, y, ReadPixel(metaSurface, area->x + x, area->y + y));
+        }
+    }
+
+    return ret;
+}
+
+void MakeTileSheet( TileSheet* sheet, SDL_Surface* image, const int tile_square )
+{
+    /* Going through GetSubSurface() leaves every pixel exactly as it was
+     * when each tile got a surface of its own. */
+    sheet->surface = GetSubSurface(image, 0, 0, image->w, image->h);
+    sheet->rects.clear();
+    sheet->masks.clear();
+
+    if (sheet->surface == NULL)
+    {
+        return;
+    }
+
+    for (int j = 0; j < image->h / tile_square; ++j)
+    {
+        for (int i = 0; i < image->w / tile_square; ++i)
+        {
+            SDL_Rect rect;
+            setRect(rect, i * tile_square, j * tile_square, tile_square, tile_square);
+            sheet->rects.push_back(rect);
+        }
+    }
+}
+
+/* Bit x of a row is set if that pixel has any red in it. Not alpha: this
+ * is for Graphics::Hitest(), which has to keep checking the red channel.
+ * Tiles wider than 32 pixels don't fit, so they don't get masks. */
+void MakeTileSheetMasks( TileSheet* sheet )
+{
+    sheet->masks.clear();
+
+    if (sheet->surface == NULL || sheet->rects.empty() || sheet->rects[0].w > 32)
+    {
+        return;
+    }
+
+    const Uint32 rmask = sheet->surface->format->Rmask;
+
+    for (size_t i = 0; i < sheet->rects.size(); i++)
+    {
+        const SDL_Rect& rect = sheet->rects[i];
+
+        for (int y = 0; y < rect.h; y++)
+        {
+            Uint32 row = 0;
+
+            for (int x = 0; x < rect.w; x++)
+            {
+                if (ReadPixel(sheet->surface, rect.x + x, rect.y + y) & rmask)
+                {
+                    row |= (Uint32) 1 << x;
+                }
+            }
+
+            sheet->masks.push_back(row);
+        }
+    }
+}
+
+void FreeTileSheet( TileSheet* sheet )
+{
+    SDL_FreeSurface(sheet->surface);
+    sheet->surface = NULL;
+    sheet->rects.clear();
+    sheet->masks.clear();
+}
+
 Uint32 ReadPixel( SDL_Surface *_surface, int x, int y )
 {
     int bpp = _surface->format->BytesPerPixel;
@@ -197,13 +301,281 @@ void BlitSurfaceStandard( SDL_Surface* _src, SDL_Rect* _srcRect, SDL_Surface* _d
     SDL_BlitSurface( _src, _srcRect, _dest, _destRect );
 }
 
-void BlitSurfaceColoured(
+/* Clip a blit the same way SDL_BlitSurface() does: first the source rect
+ * against the source surface, then the destination against its clip rect.
+ * Like SDL, this writes the final rect back into dstrect.
+ * Returns false if there is nothing left to draw. */
+static bool ClipBlit(
+    const SDL_Surface* _src,
+    const SDL_Rect* _srcRect,
+    const SDL_Surface* _dest,
+    SDL_Rect* dstrect,
+    SDL_Rect* clipped_src
+) {
+    int srcx;
+    int srcy;
+    int w;
+    int h;
+    int dx;
+    int dy;
+
+    if (_srcRect != NULL)
+    {
+        srcx = _srcRect->x;
+        w = _srcRect->w;
+        if (srcx < 0)
+        {
+            w += srcx;
+            dstrect->x -= srcx;
+            srcx = 0;
+        }
+        w = SDL_min(w, _src->w - srcx);
+
+        srcy = _srcRect->y;
+        h = _srcRect->h;
+        if (srcy < 0)
+        {
+            h += srcy;
+            dstrect->y -= srcy;
+            srcy = 0;
+        }
+        h = SDL_min(h, _src->h - srcy);
+    }
+    else
+    {
+        srcx = 0;
+        srcy = 0;
+        w = _src->w;
+        h = _src->h;
+    }
+
+    dx = _dest->clip_rect.x - dstrect->x;
+    if (dx > 0)
+    {
+        w -= dx;
+        dstrect->x += dx;
+        srcx += dx;
+    }
+    dx = dstrect->x + w - _dest->clip_rect.x - _dest->clip_rect.w;
+    if (dx > 0)
+    {
+        w -= dx;
+    }
+
+    dy = _dest->clip_rect.y - dstrect->y;
+    if (dy > 0)
+    {
+        h -= dy;
+        dstrect->y += dy;
+        srcy += dy;
+    }
+    dy = dstrect->y + h - _dest->clip_rect.y - _dest->clip_rect.h;
+    if (dy > 0)
+    {
+        h -= dy;
+    }
+
+    if (w <= 0 || h <= 0)
+    {
+        dstrect->w = 0;
+        dstrect->h = 0;
+        return false;
+    }
+
+    setRect(*clipped_src, srcx, srcy, w, h);
+    dstrect->w = w;
+    dstrect->h = h;
+    return true;
+}
+
+/* The fast paths below only know about 32-bit ARGB with per-pixel alpha,
+ * which is what LoadImage() and create_buffers() give us anyway. */
+static bool IsARGB8888(const SDL_Surface* surface)
+{
+    const SDL_PixelFormat* fmt = surface->format;
+    return fmt->BytesPerPixel == 4
+    && fmt->Amask == 0xFF000000
+    && fmt->Rmask == 0x00FF0000
+    && fmt->Gmask == 0x0000FF00
+    && fmt->Bmask == 0x000000FF;
+}
+
+/* The arithmetic of the C BlitRGBtoRGBPixelAlpha() in SDL's blitter for
+ * ARGB8888 onto ARGB8888 with blending. Other SDL versions and SIMD
+ * paths can round differently, so BlendMatchesSDL() checks this against
+ * the real thing before any of it is used. */
+static SDL_INLINE Uint32 BlendPixel(const Uint32 s, const Uint32 d)
+{
+    const Uint32 alpha = s >> 24;
+    Uint32 s1;
+    Uint32 d1;
+    Uint32 s2;
+    Uint32 d2;
+    Uint32 dalpha;
+
+    if (alpha == 0)
+    {
+        return d;
+    }
+    if (alpha == 0xFF)
+    {
+        return s;
+    }
+
+    s1 = s & 0xFF00FF;
+    d1 = d & 0xFF00FF;
+    d1 = (d1 + ((s1 - d1) * alpha >> 8)) & 0xFF00FF;
+    s2 = s & 0xFF00;
+    d2 = d & 0xFF00;
+    d2 = (d2 + ((s2 - d2) * alpha >> 8)) & 0xFF00;
+    dalpha = alpha + ((d >> 24) * (alpha ^ 0xFF) >> 8);
+    return d1 | d2 | (dalpha << 24);
+}
+
+/* Blend every alpha against every pair of source and destination values
+ * of each channel, once with SDL_BlitSurface() and once with BlendPixel().
+ * The channels get different orderings of 0-255 so they aren't all the
+ * same sum. */
+static bool BlendMatchesSDL(void)
+{
+    SDL_Surface* src = SDL_CreateRGBSurface(
+        0, 256, 256, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000
+    );
+    SDL_Surface* dest = SDL_CreateRGBSurface(
+        0, 256, 256, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000
+    );
+    bool matches = false;
+
+    if (src == NULL || dest == NULL)
+    {
+        goto end;
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceBlendMode(dest, SDL_BLENDMODE_NONE);
+
+    for (Uint32 alpha = 0; alpha < 256; alpha++)
+    {
+        for (Uint32 y = 0; y < 256; y++)
+        {
+            Uint32* srcrow = (Uint32*) ((Uint8*) src->pixels + y * src->pitch);
+            Uint32* destrow = (Uint32*) ((Uint8*) dest->pixels + y * dest->pitch);
+
+            for (Uint32 x = 0; x < 256; x++)
+            {
+                srcrow[x] = alpha << 24 | x << 16 | (x ^ 0x55) << 8 | (255 - x);
+                destrow[x] = y << 24 | (y ^ 0xAA) << 16 | (255 - y) << 8 | y;
+            }
+        }
+
+        if (SDL_BlitSurface(src, NULL, dest, NULL) != 0)
+        {
+            goto end;
+        }
+
+        for (Uint32 y = 0; y < 256; y++)
+        {
+            const Uint32* srcrow = (const Uint32*) ((const Uint8*) src->pixels + y * src->pitch);
+            const Uint32* destrow = (const Uint32*) ((const Uint8*) dest->pixels + y * dest->pitch);
+            const Uint32 d = y << 24 | (y ^ 0xAA) << 16 | (255 - y) << 8 | y;
+
+            for (Uint32 x = 0; x < 256; x++)
+            {
+                if (destrow[x] != BlendPixel(srcrow[x], d))
+                {
+                    vlog_info(
+                        "SDL blends %08X onto %08X as %08X, not %08X; using SDL for coloured blits",
+                        srcrow[x], d, destrow[x], BlendPixel(srcrow[x], d)
+                    );
+                    goto end;
+                }
+            }
+        }
+    }
+
+    matches = true;
+
+end:
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dest);
+    return matches;
+}
+
+static enum BlitKernels blit_kernels = BlitKernels_Auto;
+
+bool BlitDirectMatchesSDL(void)
+{
+    static bool checked = false;
+    static bool matches = false;
+
+    if (!checked)
+    {
+        matches = BlendMatchesSDL();
+        checked = true;
+    }
+
+    return matches;
+}
+
+static bool CanBlitDirect(SDL_Surface* _src, SDL_Surface* _dest)
+{
+    SDL_BlendMode blend_mode;
+
+    if (blit_kernels == BlitKernels_SDL
+    || _src == NULL || _dest == NULL
+    || SDL_MUSTLOCK(_src) || SDL_MUSTLOCK(_dest)
+    || !IsARGB8888(_src) || !IsARGB8888(_dest))
+    {
+        return false;
+    }
+
+    /* The temporary surface of the old path only copied the blend mode,
+     * so the alpha and colour mods of _src never mattered. */
+    SDL_GetSurfaceBlendMode(_src, &blend_mode);
+    if (blend_mode != SDL_BLENDMODE_BLEND)
+    {
+        return false;
+    }
+
+    /* Asking for a kernel by name skips the check, so they can be compared
+     * with each other even where SDL rounds differently. */
+    return blit_kernels != BlitKernels_Auto || BlitDirectMatchesSDL();
+}
+
+/* The slow paths recolour all of the surface they're given, so when a blit
+ * only reads part of a sheet, that part is copied out first. Returns NULL
+ * if the whole of _src should be used instead: there's no _srcRect, it
+ * isn't inside _src, or the copy failed. */
+static SDL_Surface* CopyBlitSource(SDL_Surface* _src, const SDL_Rect* _srcRect)
+{
+    const SDL_Rect bounds = {0, 0, _src->w, _src->h};
+    SDL_Rect inside;
+
+    if (_srcRect == NULL
+    || !SDL_IntersectRect(_srcRect, &bounds, &inside)
+    || inside.x != _srcRect->x || inside.y != _srcRect->y
+    || inside.w != _srcRect->w || inside.h != _srcRect->h)
+    {
+        return NULL;
+    }
+
+    return CopySubSurface(_src, _srcRect);
+}
+
+static void BlitSurfaceColouredSlow(
     SDL_Surface* _src,
     SDL_Rect* _srcRect,
     SDL_Surface* _dest,
     SDL_Rect* _destRect,
     colourTransform& ct
 ) {
+    SDL_Surface* tile = CopyBlitSource(_src, _srcRect);
+    if (tile != NULL)
+    {
+        BlitSurfaceColouredSlow(tile, NULL, _dest, _destRect, ct);
+        SDL_FreeSurface(tile);
+        return;
+    }
+
     SDL_Rect *tempRect = _destRect;
 
     const SDL_PixelFormat& fmt = *(_src->format);
@@ -229,18 +601,15 @@ void BlitSurfaceColoured(
     SDL_FreeSurface(tempsurface);
 }
 
-void BlitSurfaceTinted(
-    SDL_Surface* _src,
-    SDL_Rect* _srcRect,
-    SDL_Surface* _dest,
-    SDL_Rect* _destRect,
-    colourTransform& ct
-) {
-    SDL_Rect *tempRect = _destRect;
-
+SDL_Surface* TintSurface(SDL_Surface* _src, colourTransform& ct)
+{
     const SDL_PixelFormat& fmt = *(_src->format);
 
     SDL_Surface* tempsurface =  RecreateSurface(_src);
+    if (tempsurface == NULL)
+    {
+        return NULL;
+    }
 
     for (int x = 0; x < tempsurface->w; x++) {
         for (int y = 0; y < tempsurface->h; y++) {
@@ -286,93 +655,911 @@ void BlitSurfaceTinted(
         }
     }
 
-    SDL_BlitSurface(tempsurface, _srcRect, _dest, tempRect);
+    return tempsurface;
+}
+
+static void BlitSurfaceTintedSlow(
+    SDL_Surface* _src,
+    SDL_Rect* _srcRect,
+    SDL_Surface* _dest,
+    SDL_Rect* _destRect,
+    colourTransform& ct
+) {
+    SDL_Surface* tile = CopyBlitSource(_src, _srcRect);
+    if (tile != NULL)
+    {
+        BlitSurfaceTintedSlow(tile, NULL, _dest, _destRect, ct);
+        SDL_FreeSurface(tile);
+        return;
+    }
+
+    SDL_Surface* tempsurface = TintSurface(_src, ct);
+    if (tempsurface == NULL)
+    {
+        return;
+    }
+
+    SDL_BlitSurface(tempsurface, _srcRect, _dest, _destRect);
     SDL_FreeSurface(tempsurface);
 }
 
+typedef void (*BlitRowFunc)(
+    const Uint32* src,
+    Uint32* dest,
+    int w,
+    Uint32 colour
+);
+
+static void ColouredRow_Scalar(
+    const Uint32* src,
+    Uint32* dest,
+    const int w,
+    const Uint32 colour
+) {
+    const Uint32 rgb = colour & 0x00FFFFFF;
+    const Uint32 ct_alpha = colour >> 24;
 
-static int oldscrollamount = 0;
-static int scrollamount = 0;
-static bool isscrolling = 0;
+    for (int x = 0; x < w; x++)
+    {
+        /* (a/255.0f) * (b/255.0f) * 255.0f truncates to exactly this
+         * for every pair of 8-bit values. */
+        const Uint32 alpha = (src[x] >> 24) * ct_alpha / 255;
+        dest[x] = BlendPixel(rgb | (alpha << 24), dest[x]);
+    }
+}
 
-void UpdateFilter(void)
+static void TintedRow_Scalar(
+    const Uint32* src,
+    Uint32* dest,
+    const int w,
+    const Uint32 colour
+) {
+    const Uint8 ctred = (colour >> 16) & 0xFF;
+    const Uint8 ctgreen = (colour >> 8) & 0xFF;
+    const Uint8 ctblue = colour & 0xFF;
+    const Uint32 ct_alpha = colour >> 24;
+
+    for (int x = 0; x < w; x++)
+    {
+        const Uint32 pixel = src[x];
+
+        /* Keep this in doubles, the rounding of the greyscale conversion
+         * does not match any integer formula on exact halves. */
+        const double gray = SDL_floor(
+            ((pixel >> 16) & 0xFF) * 0.299
+            + ((pixel >> 8) & 0xFF) * 0.587
+            + (pixel & 0xFF) * 0.114
+            + 0.5
+        );
+        const Uint32 gray_i = (Uint32) gray;
+
+        /* gray * ct / 255.0 never exceeds 255 and truncates exactly like
+         * the integer division does. */
+        const Uint32 result = (gray_i * ctred / 255) << 16
+            | (gray_i * ctgreen / 255) << 8
+            | (gray_i * ctblue / 255);
+        const Uint32 alpha = (pixel >> 24) * ct_alpha / 255;
+
+        dest[x] = BlendPixel(result | (alpha << 24), dest[x]);
+    }
+}
+
+#ifdef GRAPHICSUTIL_SSE2
+/* Multiply each 32-bit lane of v by the matching lane of k, modulo 2^32.
+ * k has to be below 2^16. SSE2 has no _mm_mullo_epi32(), but this only
+ * needs one extra multiply. */
+static SDL_INLINE __m128i MulLo32_SSE2(const __m128i v, const __m128i k)
+{
+    const __m128i k16 = _mm_or_si128(k, _mm_slli_epi32(k, 16));
+    const __m128i lo = _mm_mullo_epi16(v, k16);
+    const __m128i hi = _mm_mulhi_epu16(v, k16);
+    return _mm_add_epi32(lo, _mm_slli_epi32(hi, 16));
+}
+
+/* x / 255 for 0 <= x <= 255 * 255 */
+static SDL_INLINE __m128i Div255_SSE2(const __m128i x)
 {
-    if (rand() % 4000 < 8)
+    const __m128i one = _mm_set1_epi32(1);
+    return _mm_srli_epi32(
+        _mm_add_epi32(_mm_add_epi32(x, one), _mm_srli_epi32(x, 8)),
+        8
+    );
+}
+
+/* Fully transparent source pixels leave the destination alone, and sprites
+ * are mostly made of those. */
+static SDL_INLINE bool AllClear_SSE2(const __m128i s)
+{
+    const __m128i alpha = _mm_srli_epi32(s, 24);
+    return _mm_movemask_epi8(
+        _mm_cmpeq_epi32(alpha, _mm_setzero_si128())
+    ) == 0xFFFF;
+}
+
+/* Four pixels of BlendPixel(), wraparound and all. */
+static SDL_INLINE __m128i BlendPixels_SSE2(const __m128i s, const __m128i d)
+{
+    const __m128i rb_mask = _mm_set1_epi32(0x00FF00FF);
+    const __m128i g_mask = _mm_set1_epi32(0x0000FF00);
+    const __m128i ff = _mm_set1_epi32(0xFF);
+    const __m128i alpha = _mm_srli_epi32(s, 24);
+
+    __m128i d1 = _mm_and_si128(d, rb_mask);
+    __m128i d2 = _mm_and_si128(d, g_mask);
+    __m128i dalpha = _mm_srli_epi32(d, 24);
+    __m128i result;
+    __m128i is_opaque;
+    __m128i is_clear;
+
+    d1 = _mm_add_epi32(d1, _mm_srli_epi32(MulLo32_SSE2(
+        _mm_sub_epi32(_mm_and_si128(s, rb_mask), d1),
+        alpha
+    ), 8));
+    d1 = _mm_and_si128(d1, rb_mask);
+
+    d2 = _mm_add_epi32(d2, _mm_srli_epi32(MulLo32_SSE2(
+        _mm_sub_epi32(_mm_and_si128(s, g_mask), d2),
+        alpha
+    ), 8));
+    d2 = _mm_and_si128(d2, g_mask);
+
+    dalpha = _mm_add_epi32(alpha, _mm_srli_epi32(
+        _mm_mullo_epi16(dalpha, _mm_xor_si128(alpha, ff)),
+        8
+    ));
+
+    result = _mm_or_si128(
+        _mm_or_si128(d1, d2),
+        _mm_slli_epi32(dalpha, 24)
+    );
+
+    is_opaque = _mm_cmpeq_epi32(alpha, ff);
+    is_clear = _mm_cmpeq_epi32(alpha, _mm_setzero_si128());
+    result = _mm_or_si128(
+        _mm_and_si128(is_opaque, s),
+        _mm_andnot_si128(is_opaque, result)
+    );
+    result = _mm_or_si128(
+        _mm_and_si128(is_clear, d),
+        _mm_andnot_si128(is_clear, result)
+    );
+    return result;
+}
+
+static void ColouredRow_SSE2(
+    const Uint32* src,
+    Uint32* dest,
+    const int w,
+    const Uint32 colour
+) {
+    const __m128i rgb = _mm_set1_epi32(colour & 0x00FFFFFF);
+    const __m128i ct_alpha = _mm_set1_epi32(colour >> 24);
+    int x;
+
+    for (x = 0; x + 4 <= w; x += 4)
     {
-        isscrolling = true;
+        const __m128i s = _mm_loadu_si128((const __m128i*) &src[x]);
+        __m128i d;
+        __m128i alpha;
+
+        if (AllClear_SSE2(s))
+        {
+            continue;
+        }
+
+        d = _mm_loadu_si128((const __m128i*) &dest[x]);
+        alpha = Div255_SSE2(
+            _mm_mullo_epi16(_mm_srli_epi32(s, 24), ct_alpha)
+        );
+
+        _mm_storeu_si128(
+            (__m128i*) &dest[x],
+            BlendPixels_SSE2(_mm_or_si128(rgb, _mm_slli_epi32(alpha, 24)), d)
+        );
     }
 
-    oldscrollamount = scrollamount;
-    if(isscrolling == true)
+    ColouredRow_Scalar(&src[x], &dest[x], w - x, colour);
+}
+
+/* Greyscale of two pixels in the low two lanes of each channel, using the
+ * same double arithmetic (and order of operations) as the scalar path. */
+static SDL_INLINE __m128i Gray2_SSE2(
+    const __m128i r,
+    const __m128i g,
+    const __m128i b
+) {
+    const __m128d sum = _mm_add_pd(
+        _mm_add_pd(
+            _mm_add_pd(
+                _mm_mul_pd(_mm_cvtepi32_pd(r), _mm_set1_pd(0.299)),
+                _mm_mul_pd(_mm_cvtepi32_pd(g), _mm_set1_pd(0.587))
+            ),
+            _mm_mul_pd(_mm_cvtepi32_pd(b), _mm_set1_pd(0.114))
+        ),
+        _mm_set1_pd(0.5)
+    );
+
+    /* Always positive, so truncation is the same as SDL_floor(). */
+    return _mm_cvttpd_epi32(sum);
+}
+
+static void TintedRow_SSE2(
+    const Uint32* src,
+    Uint32* dest,
+    const int w,
+    const Uint32 colour
+) {
+    const __m128i ff = _mm_set1_epi32(0xFF);
+    const __m128i ctred = _mm_set1_epi32((colour >> 16) & 0xFF);
+    const __m128i ctgreen = _mm_set1_epi32((colour >> 8) & 0xFF);
+    const __m128i ctblue = _mm_set1_epi32(colour & 0xFF);
+    const __m128i ct_alpha = _mm_set1_epi32(colour >> 24);
+    int x;
+
+    for (x = 0; x + 4 <= w; x += 4)
     {
-        scrollamount += 20;
-        if(scrollamount > 240)
+        const __m128i s = _mm_loadu_si128((const __m128i*) &src[x]);
+        __m128i d;
+        __m128i r;
+        __m128i g;
+        __m128i b;
+        __m128i gray;
+        __m128i alpha;
+        __m128i result;
+
+        if (AllClear_SSE2(s))
         {
-            scrollamount = 0;
-            oldscrollamount = 0;
-            isscrolling = false;
+            continue;
         }
+
+        d = _mm_loadu_si128((const __m128i*) &dest[x]);
+        r = _mm_and_si128(_mm_srli_epi32(s, 16), ff);
+        g = _mm_and_si128(_mm_srli_epi32(s, 8), ff);
+        b = _mm_and_si128(s, ff);
+        gray = _mm_unpacklo_epi64(
+            Gray2_SSE2(r, g, b),
+            Gray2_SSE2(
+                _mm_srli_si128(r, 8),
+                _mm_srli_si128(g, 8),
+                _mm_srli_si128(b, 8)
+            )
+        );
+        alpha = Div255_SSE2(
+            _mm_mullo_epi16(_mm_srli_epi32(s, 24), ct_alpha)
+        );
+        result = _mm_or_si128(
+            _mm_or_si128(
+                _mm_slli_epi32(Div255_SSE2(_mm_mullo_epi16(gray, ctred)), 16),
+                _mm_slli_epi32(Div255_SSE2(_mm_mullo_epi16(gray, ctgreen)), 8)
+            ),
+            _mm_or_si128(
+                Div255_SSE2(_mm_mullo_epi16(gray, ctblue)),
+                _mm_slli_epi32(alpha, 24)
+            )
+        );
+
+        _mm_storeu_si128((__m128i*) &dest[x], BlendPixels_SSE2(result, d));
     }
+
+    TintedRow_Scalar(&src[x], &dest[x], w - x, colour);
 }
+#endif /* GRAPHICSUTIL_SSE2 */
 
-SDL_Surface* ApplyFilter( SDL_Surface* _src )
+#ifdef GRAPHICSUTIL_NEON
+static SDL_INLINE uint32x4_t Div255_NEON(const uint32x4_t x)
 {
-    SDL_Surface* _ret = RecreateSurface(_src);
+    return vshrq_n_u32(
+        vaddq_u32(vaddq_u32(x, vdupq_n_u32(1)), vshrq_n_u32(x, 8)),
+        8
+    );
+}
+
+static SDL_INLINE uint32x4_t BlendPixels_NEON(
+    const uint32x4_t s,
+    const uint32x4_t d
+) {
+    const uint32x4_t rb_mask = vdupq_n_u32(0x00FF00FF);
+    const uint32x4_t g_mask = vdupq_n_u32(0x0000FF00);
+    const uint32x4_t ff = vdupq_n_u32(0xFF);
+    const uint32x4_t alpha = vshrq_n_u32(s, 24);
+
+    uint32x4_t d1 = vandq_u32(d, rb_mask);
+    uint32x4_t d2 = vandq_u32(d, g_mask);
+    uint32x4_t dalpha;
+    uint32x4_t result;
+
+    d1 = vaddq_u32(d1, vshrq_n_u32(
+        vmulq_u32(vsubq_u32(vandq_u32(s, rb_mask), d1), alpha),
+        8
+    ));
+    d1 = vandq_u32(d1, rb_mask);
+
+    d2 = vaddq_u32(d2, vshrq_n_u32(
+        vmulq_u32(vsubq_u32(vandq_u32(s, g_mask), d2), alpha),
+        8
+    ));
+    d2 = vandq_u32(d2, g_mask);
+
+    dalpha = vaddq_u32(alpha, vshrq_n_u32(
+        vmulq_u32(vshrq_n_u32(d, 24), veorq_u32(alpha, ff)),
+        8
+    ));
+
+    result = vorrq_u32(vorrq_u32(d1, d2), vshlq_n_u32(dalpha, 24));
+    result = vbslq_u32(vceqq_u32(alpha, ff), s, result);
+    result = vbslq_u32(vceqq_u32(alpha, vdupq_n_u32(0)), d, result);
+    return result;
+}
 
-    int redOffset = rand() % 4;
+static void ColouredRow_NEON(
+    const Uint32* src,
+    Uint32* dest,
+    const int w,
+    const Uint32 colour
+) {
+    const uint32x4_t rgb = vdupq_n_u32(colour & 0x00FFFFFF);
+    const uint32x4_t ct_alpha = vdupq_n_u32(colour >> 24);
+    int x;
 
-    for(int x = 0; x < _src->w; x++)
+    for (x = 0; x + 4 <= w; x += 4)
     {
-        for(int y = 0; y < _src->h; y++)
+        const uint32x4_t s = vld1q_u32(&src[x]);
+        const uint32x4_t d = vld1q_u32(&dest[x]);
+        const uint32x4_t alpha = Div255_NEON(
+            vmulq_u32(vshrq_n_u32(s, 24), ct_alpha)
+        );
+
+        vst1q_u32(
+            &dest[x],
+            BlendPixels_NEON(vorrq_u32(rgb, vshlq_n_u32(alpha, 24)), d)
+        );
+    }
+
+    ColouredRow_Scalar(&src[x], &dest[x], w - x, colour);
+}
+#endif /* GRAPHICSUTIL_NEON */
+
+static BlitRowFunc coloured_row = NULL;
+static BlitRowFunc tinted_row = NULL;
+
+/* Pick the widest kernels the CPU we're actually running on supports.
+ * All of them are bit-for-bit identical to the scalar ones. */
+static void ChoosePixelKernels(void)
+{
+    coloured_row = ColouredRow_Scalar;
+    tinted_row = TintedRow_Scalar;
+
+    if (blit_kernels == BlitKernels_Scalar)
+    {
+        return;
+    }
+
+#ifdef GRAPHICSUTIL_SSE2
+    if (SDL_HasSSE2())
+    {
+        coloured_row = ColouredRow_SSE2;
+        tinted_row = TintedRow_SSE2;
+    }
+#endif
+
+#ifdef GRAPHICSUTIL_NEON
+    if (SDL_HasNEON())
+    {
+        coloured_row = ColouredRow_NEON;
+    }
+#endif
+}
+
+#ifdef SELFTEST
+void SetBlitKernels(const enum BlitKernels kernels)
+{
+    blit_kernels = kernels;
+    coloured_row = NULL;
+    tinted_row = NULL;
+}
+#endif
+
+static void BlitDirect(
+    SDL_Surface* _src,
+    SDL_Rect* _srcRect,
+    SDL_Surface* _dest,
+    SDL_Rect* _destRect,
+    const BlitRowFunc row,
+    const Uint32 colour
+) {
+    SDL_Rect destrect;
+    SDL_Rect srcrect;
+    const Uint8* srcrow;
+    Uint8* destrow;
+
+    if (_destRect != NULL)
+    {
+        destrect = *_destRect;
+    }
+    else
+    {
+        setRect(destrect, 0, 0, _dest->w, _dest->h);
+    }
+
+    if (ClipBlit(_src, _srcRect, _dest, &destrect, &srcrect))
+    {
+        srcrow = (const Uint8*) _src->pixels
+            + srcrect.y * _src->pitch + srcrect.x * 4;
+        destrow = (Uint8*) _dest->pixels
+            + destrect.y * _dest->pitch + destrect.x * 4;
+
+        for (int y = 0; y < srcrect.h; y++)
         {
-            int sampley = (y + (int) graphics.lerp(oldscrollamount, scrollamount) )% 240;
+            row((const Uint32*) srcrow, (Uint32*) destrow, srcrect.w, colour);
+            srcrow += _src->pitch;
+            destrow += _dest->pitch;
+        }
+    }
 
-            Uint32 pixel = ReadPixel(_src, x,sampley);
+    if (_destRect != NULL)
+    {
+        *_destRect = destrect;
+    }
+}
 
-            Uint8 green = (pixel & _src->format->Gmask) >> 8;
-            Uint8 blue = (pixel & _src->format->Bmask) >> 0;
+void BlitSurfaceColoured(
+    SDL_Surface* _src,
+    SDL_Rect* _srcRect,
+    SDL_Surface* _dest,
+    SDL_Rect* _destRect,
+    colourTransform& ct
+) {
+    if (!CanBlitDirect(_src, _dest))
+    {
+        BlitSurfaceColouredSlow(_src, _srcRect, _dest, _destRect, ct);
+        return;
+    }
 
-            Uint32 pixelOffset = ReadPixel(_src, SDL_min(x+redOffset, 319), sampley) ;
-            Uint8 red = (pixelOffset & _src->format->Rmask) >> 16 ;
+    if (coloured_row == NULL)
+    {
+        ChoosePixelKernels();
+    }
 
-            double mult;
-            int tmp; /* needed to avoid char overflow */
-            if(isscrolling && sampley > 220 && ((rand() %10) < 4))
-            {
-                mult = 0.6;
-            }
-            else
-            {
-                mult = 0.2;
-            }
+    BlitDirect(_src, _srcRect, _dest, _destRect, coloured_row, ct.colour);
+}
+
+void BlitSurfaceTinted(
+    SDL_Surface* _src,
+    SDL_Rect* _srcRect,
+    SDL_Surface* _dest,
+    SDL_Rect* _destRect,
+    colourTransform& ct
+) {
+    if (!CanBlitDirect(_src, _dest) || !IsARGB8888(graphics.backBuffer))
+    {
+        BlitSurfaceTintedSlow(_src, _srcRect, _dest, _destRect, ct);
+        return;
+    }
 
-            tmp = red + fRandom() * mult * 254;
-            red = SDL_min(tmp, 255);
-            tmp = green + fRandom() * mult * 254;
-            green = SDL_min(tmp, 255);
-            tmp = blue + fRandom() * mult * 254;
-            blue = SDL_min(tmp, 255);
+    if (tinted_row == NULL)
+    {
+        ChoosePixelKernels();
+    }
 
-            if(y % 2 == 0)
+    BlitDirect(_src, _srcRect, _dest, _destRect, tinted_row, ct.colour);
+}
+
+/* BlitDirect() with the coloured kernel, but with the source rect blown
+ * up by an integer factor first, and optionally read upside down.
+ * Samples the same source pixels SDL_BlitScaled() does; the coloured
+ * blit only reads alpha, which the old ScaleSurface() round trip left
+ * untouched. */
+static void BlitColouredScaledDirect(
+    SDL_Surface* _src,
+    const SDL_Rect* _srcRect,
+    const int scale,
+    const bool flip,
+    SDL_Surface* _dest,
+    const SDL_Rect* _destRect,
+    const Uint32 colour
+) {
+    const int incx = 0x10000 / scale;
+    const int incy = 0x10000 / scale;
+    const SDL_Rect* clip = &_dest->clip_rect;
+    const int x0 = SDL_max(_destRect->x, clip->x);
+    const int y0 = SDL_max(_destRect->y, clip->y);
+    const int x1 = SDL_min(_destRect->x + _destRect->w, clip->x + clip->w);
+    const int y1 = SDL_min(_destRect->y + _destRect->h, clip->y + clip->h);
+    Uint32 row[64];
+
+    for (int y = y0; y < y1; y++)
+    {
+        const int row_offset = (incy / 2 + (y - _destRect->y) * incy) >> 16;
+        const int sy = flip
+            ? _srcRect->y + _srcRect->h - 1 - row_offset
+            : _srcRect->y + row_offset;
+        const Uint32* srcrow = (const Uint32*) ((const Uint8*) _src->pixels
+            + sy * _src->pitch) + _srcRect->x;
+        Uint32* destrow = (Uint32*) ((Uint8*) _dest->pixels
+            + y * _dest->pitch);
+
+        for (int x = x0; x < x1; x += SDL_arraysize(row))
+        {
+            const int w = SDL_min((int) SDL_arraysize(row), x1 - x);
+
+            for (int i = 0; i < w; i++)
             {
-                red = static_cast<Uint8>(red / 1.2f);
-                green = static_cast<Uint8>(green / 1.2f);
-                blue =  static_cast<Uint8>(blue / 1.2f);
+                row[i] = srcrow[(incx / 2 + (x + i - _destRect->x) * incx) >> 16];
             }
 
-            int distX =  static_cast<int>((SDL_abs (160.0f -x ) / 160.0f) *16);
-            int distY =  static_cast<int>((SDL_abs (120.0f -y ) / 120.0f)*32);
+            coloured_row(row, &destrow[x], w, colour);
+        }
+    }
+}
+
+static void BlitTileColouredSlow(
+    SDL_Surface* _sheet,
+    const SDL_Rect* _tile,
+    const int scale,
+    const bool flip,
+    SDL_Surface* _dest,
+    SDL_Rect* _destRect,
+    colourTransform& ct
+) {
+    SDL_Surface* tile = GetSubSurface(
+        _sheet,
+        _tile->x,
+        _tile->y,
+        _tile->w,
+        _tile->h
+    );
+
+    if (tile == NULL)
+    {
+        return;
+    }
+
+    if (flip)
+    {
+        SDL_Surface* flipped = FlipSurfaceVerticle(tile);
+        SDL_FreeSurface(tile);
+        tile = flipped;
 
-            red = SDL_max(red - ( distX +distY), 0);
-            green = SDL_max(green - ( distX +distY), 0);
-            blue = SDL_max(blue - ( distX +distY), 0);
+        if (tile == NULL)
+        {
+            return;
+        }
+    }
 
-            Uint32 finalPixel = ((red<<16) + (green<<8) + (blue<<0)) | (pixel &_src->format->Amask);
-            DrawPixel(_ret,x,y,  finalPixel);
+    if (scale > 1)
+    {
+        SDL_Surface* scaled = ScaleSurface(tile, _destRect->w, _destRect->h);
+        SDL_FreeSurface(tile);
+        tile = scaled;
 
+        if (tile == NULL)
+        {
+            return;
+        }
+    }
+
+    BlitSurfaceColouredSlow(tile, NULL, _dest, _destRect, ct);
+    SDL_FreeSurface(tile);
+}
+
+void BlitTilesColoured(
+    SDL_Surface* _sheet,
+    const SDL_Rect* _tiles,
+    const SDL_Point* _positions,
+    const int count,
+    const int scale,
+    const bool flip,
+    SDL_Surface* _dest,
+    colourTransform& ct
+) {
+    const bool direct = CanBlitDirect(_sheet, _dest);
+
+    if (direct && coloured_row == NULL)
+    {
+        ChoosePixelKernels();
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        SDL_Rect tile = _tiles[i];
+        SDL_Rect destrect;
+        setRect(
+            destrect,
+            _positions[i].x,
+            _positions[i].y,
+            tile.w * scale,
+            tile.h * scale
+        );
+
+        if (!direct)
+        {
+            BlitTileColouredSlow(_sheet, &tile, scale, flip, _dest, &destrect, ct);
+        }
+        else if (scale == 1 && !flip)
+        {
+            BlitDirect(_sheet, &tile, _dest, &destrect, coloured_row, ct.colour);
+        }
+        else
+        {
+            BlitColouredScaledDirect(_sheet, &tile, scale, flip, _dest, &destrect, ct.colour);
+        }
+    }
+}
+
+/* Vertical ring buffers. Logical row y of a ring surface lives at physical
+ * row (y + origin) % h, so scrolling one only has to move the origin.
+ * These mirror ScrollSurface() and SDL_BlitSurface() on the logical rows
+ * exactly, quirks included. */
+
+static SDL_INLINE Uint8* RingRow(SDL_Surface* _ring, const int origin, const int y)
+{
+    return (Uint8*) _ring->pixels + ((y + origin) % _ring->h) * _ring->pitch;
+}
+
+/* Same as ScrollSurface(_ring, 0, _pY) */
+void ScrollRingSurface( SDL_Surface* _ring, int* origin, const int _pY )
+{
+    const int h = _ring->h;
+    const int rowbytes = _ring->w * _ring->format->BytesPerPixel;
+
+    if (_pY < 0)
+    {
+        /* Scrolling up. What comes in at the bottom gets cleared. */
+        const int n = SDL_min(-_pY, h);
+        *origin = (*origin + n) % h;
+        for (int y = h - n; y < h; y++)
+        {
+            SDL_memset(RingRow(_ring, *origin, y), 0, rowbytes);
+        }
+    }
+    else if (_pY > 0 && _pY < h)
+    {
+        /* Scrolling down. The top rows keep what they had, so copy them
+         * to where they are now. Going bottom-up never overwrites a row
+         * that's still to be read. */
+        const int old_origin = *origin;
+        *origin = (*origin + h - _pY) % h;
+        for (int y = _pY - 1; y >= 0; y--)
+        {
+            SDL_memcpy(
+                RingRow(_ring, *origin, y),
+                RingRow(_ring, old_origin, y),
+                rowbytes
+            );
+        }
+    }
+}
+
+/* Same as SDL_BlitSurface() onto logical row _destRect->y of the ring.
+ * Done as (at most) two blits, each clipped to one side of the seam. */
+void BlitSurfaceToRing(
+    SDL_Surface* _src,
+    SDL_Rect* _srcRect,
+    SDL_Surface* _ring,
+    const int origin,
+    const SDL_Rect* _destRect
+) {
+    SDL_Rect clip;
+    SDL_Rect side;
+    SDL_Rect destrect;
+
+    SDL_GetClipRect(_ring, &clip);
+
+    setRect(side, clip.x, origin, clip.w, _ring->h - origin);
+    SDL_SetClipRect(_ring, &side);
+    setRect(destrect, _destRect->x, _destRect->y + origin, 0, 0);
+    SDL_BlitSurface(_src, _srcRect, _ring, &destrect);
+
+    if (origin > 0)
+    {
+        setRect(side, clip.x, 0, clip.w, origin);
+        SDL_SetClipRect(_ring, &side);
+        setRect(destrect, _destRect->x, _destRect->y + origin - _ring->h, 0, 0);
+        SDL_BlitSurface(_src, _srcRect, _ring, &destrect);
+    }
+
+    SDL_SetClipRect(_ring, &clip);
+}
+
+/* Copy logical rows [y, y + rows) of the ring to dest_y onwards */
+static void BlitRingRows(
+    SDL_Surface* _ring,
+    const int origin,
+    const SDL_Rect* _srcRect,
+    int y,
+    int rows,
+    SDL_Surface* _dest,
+    int dest_y
+) {
+    while (rows > 0)
+    {
+        const int physical = (y + origin) % _ring->h;
+        const int run = SDL_min(rows, _ring->h - physical);
+        SDL_Rect srcrect = {_srcRect->x, physical, _srcRect->w, run};
+        SDL_Rect destrect = {0, dest_y, 0, 0};
+
+        SDL_BlitSurface(_ring, &srcrect, _dest, &destrect);
+
+        y += run;
+        dest_y += run;
+        rows -= run;
+    }
+}
+
+/* Same as copying the ring to a scratch surface, ScrollSurface(scratch,
+ * 0, _pY), then SDL_BlitSurface(scratch, _srcRect, _dest, NULL) - but
+ * without the scratch surface. The ring must be SDL_BLENDMODE_NONE. */
+void BlitScrolledRing(
+    SDL_Surface* _ring,
+    const int origin,
+    const int _pY,
+    const SDL_Rect* _srcRect,
+    SDL_Surface* _dest
+) {
+    const int h = _ring->h;
+    const int top = SDL_max(_srcRect->y, 0);
+    const int bottom = SDL_min(_srcRect->y + _srcRect->h, h);
+    /* Scrolled rows [top, split) come from (row + shift_above), the rest
+     * from (row + shift_below); cleared ones come from nowhere. */
+    int split = bottom;
+    int shift_above = 0;
+    int shift_below = 0;
+    bool below_cleared = false;
+
+    if (_pY < 0)
+    {
+        const int n = SDL_min(-_pY, h);
+        split = SDL_clamp(h - n, top, bottom);
+        shift_above = n;
+        below_cleared = true;
+    }
+    else if (_pY > 0 && _pY < h)
+    {
+        split = SDL_clamp(_pY, top, bottom);
+        shift_below = -_pY;
+    }
+
+    BlitRingRows(
+        _ring,
+        origin,
+        _srcRect,
+        top + shift_above,
+        split - top,
+        _dest,
+        top - _srcRect->y
+    );
+
+    if (below_cleared)
+    {
+        FillRect(_dest, 0, split - _srcRect->y, _srcRect->w, bottom - split, 0x00000000);
+    }
+    else
+    {
+        BlitRingRows(
+            _ring,
+            origin,
+            _srcRect,
+            split + shift_below,
+            bottom - split,
+            _dest,
+            split - _srcRect->y
+        );
+    }
+}
+
+static int oldscrollamount = 0;
+static int scrollamount = 0;
+static bool isscrolling = 0;
+
+/* The filter has its own xorshift32 stream so it doesn't have to go
+ * through rand() several times per pixel. The noise doesn't need to be
+ * good, just fast. */
+static Uint32 filter_rng = 0x2545F491;
+
+static SDL_INLINE Uint32 FilterRandom(void)
+{
+    filter_rng ^= filter_rng << 13;
+    filter_rng ^= filter_rng >> 17;
+    filter_rng ^= filter_rng << 5;
+    return filter_rng;
+}
+
+static bool filter_tables_ready = false;
+static Uint8 filter_vignette_x[SCREEN_WIDTH_PIXELS];
+static Uint8 filter_vignette_y[SCREEN_HEIGHT_PIXELS];
+static Uint8 filter_scanline[256];
+/* Noise to add for a random byte, for the normal and the rolling-bar
+ * strength (fRandom() * 0.2 * 254 and fRandom() * 0.6 * 254 before) */
+static Uint8 filter_noise[2][256];
+
+static void InitFilterTables(void)
+{
+    for (int x = 0; x < SCREEN_WIDTH_PIXELS; x++)
+    {
+        filter_vignette_x[x] = static_cast<int>((SDL_abs(160 - x) / 160.0f) * 16);
+    }
+    for (int y = 0; y < SCREEN_HEIGHT_PIXELS; y++)
+    {
+        filter_vignette_y[y] = static_cast<int>((SDL_abs(120 - y) / 120.0f) * 32);
+    }
+    for (int i = 0; i < 256; i++)
+    {
+        filter_scanline[i] = static_cast<Uint8>(i / 1.2f);
+        filter_noise[0][i] = i * 51 / 256;
+        filter_noise[1][i] = i * 153 / 256;
+    }
+
+    filter_tables_ready = true;
+}
+
+void UpdateFilter(void)
+{
+    if (FilterRandom() % 4000 < 8)
+    {
+        isscrolling = true;
+    }
+
+    oldscrollamount = scrollamount;
+    if(isscrolling == true)
+    {
+        scrollamount += 20;
+        if(scrollamount > 240)
+        {
+            scrollamount = 0;
+            oldscrollamount = 0;
+            isscrolling = false;
+        }
+    }
+}
+
+static SDL_INLINE Uint32 FilterChannel(
+    const Uint32 value,
+    const Uint8 noise,
+    const bool scanline,
+    const int vignette
+) {
+    int channel = SDL_min(value + noise, 255);
+    if (scanline)
+    {
+        channel = filter_scanline[channel];
+    }
+    return SDL_max(channel - vignette, 0);
+}
+
+void ApplyFilter( SDL_Surface* _src, SDL_Surface* _dest )
+{
+    const int scroll = (int) graphics.lerp(oldscrollamount, scrollamount);
+    const int redOffset = FilterRandom() % 4;
+
+    if (!filter_tables_ready)
+    {
+        InitFilterTables();
+    }
+
+    for (int y = 0; y < SCREEN_HEIGHT_PIXELS; y++)
+    {
+        const int sampley = (y + scroll) % 240;
+        const Uint32* srcrow = (const Uint32*) ((const Uint8*) _src->pixels + sampley * _src->pitch);
+        Uint32* destrow = (Uint32*) ((Uint8*) _dest->pixels + y * _dest->pitch);
+        const bool rollingbar = isscrolling && sampley > 220;
+        const bool scanline = y % 2 == 0;
+
+        for (int x = 0; x < SCREEN_WIDTH_PIXELS; x++)
+        {
+            const Uint32 pixel = srcrow[x];
+            const Uint32 pixelOffset = srcrow[SDL_min(x + redOffset, 319)];
+            const Uint32 random = FilterRandom();
+            /* The rolling bar is noisier on 40% of its pixels */
+            const Uint8* noise = filter_noise[rollingbar && (random >> 24) < 102];
+            const int vignette = filter_vignette_x[x] + filter_vignette_y[y];
+
+            const Uint32 red = FilterChannel((pixelOffset >> 16) & 0xFF, noise[random & 0xFF], scanline, vignette);
+            const Uint32 green = FilterChannel((pixel >> 8) & 0xFF, noise[(random >> 8) & 0xFF], scanline, vignette);
+            const Uint32 blue = FilterChannel(pixel & 0xFF, noise[(random >> 16) & 0xFF], scanline, vignette);
+
+            destrow[x] = (red << 16) | (green << 8) | blue | (pixel & 0xFF000000);
         }
     }
-    return _ret;
 }
 
 void FillRect( SDL_Surface* _surface, const int _x, const int _y, const int _w, const int _h, const int r, int g, int b )
@@ -415,7 +1602,7 @@ void ClearSurface(SDL_Surface* surface)
     SDL_FillRect(surface, NULL, 0x00000000);
 }
 
-void ScrollSurface( SDL_Surface* _src, int _pX, int _pY )
+static void ScrollSurfaceSlow( SDL_Surface* _src, int _pX, int _pY )
 {
     SDL_Surface* part1 = NULL;
 
@@ -493,3 +1680,86 @@ void ScrollSurface( SDL_Surface* _src, int _pX, int _pY )
     }
 
 }
+
+/* Does the same thing as the GetSubSurface() dance in ScrollSurfaceSlow(),
+ * quirks included, but in place. Only valid when that blit was a plain copy,
+ * i.e. SDL_BLENDMODE_NONE, which is what all the scrolled buffers use. */
+static void ScrollSurfaceInPlace(SDL_Surface* _src, const int _pX, const int _pY)
+{
+    Uint8* pixels = (Uint8*) _src->pixels;
+    const int pitch = _src->pitch;
+    const int w = _src->w;
+    const int h = _src->h;
+
+    if (_pY < 0)
+    {
+        /* Scrolling up. _pX is ignored, and the rows scrolled in at the
+         * bottom come from the empty part of the temporary surface. */
+        const int n = SDL_min(-_pY, h);
+        for (int y = 0; y < h - n; y++)
+        {
+            SDL_memmove(&pixels[y * pitch], &pixels[(y + n) * pitch], w * 4);
+        }
+        for (int y = h - n; y < h; y++)
+        {
+            SDL_memset(&pixels[y * pitch], 0, w * 4);
+        }
+    }
+    else if (_pY > 0)
+    {
+        /* Scrolling down, and sideways by _pX. The rows at the top keep
+         * whatever they had. */
+        const int srcx = SDL_max(-_pX, 0);
+        const int destx = SDL_max(_pX, 0);
+        const int rowbytes = (w - srcx - destx) * 4;
+        if (_pY >= h || rowbytes <= 0)
+        {
+            return;
+        }
+        for (int y = h - 1; y >= _pY; y--)
+        {
+            SDL_memmove(
+                &pixels[y * pitch + destx * 4],
+                &pixels[(y - _pY) * pitch + srcx * 4],
+                rowbytes
+            );
+        }
+    }
+    else if (_pX < 0)
+    {
+        /* Scrolling left, clearing the columns scrolled in on the right */
+        const int n = SDL_min(-_pX, w);
+        for (int y = 0; y < h; y++)
+        {
+            Uint8* row = &pixels[y * pitch];
+            SDL_memmove(row, &row[n * 4], (w - n) * 4);
+            SDL_memset(&row[(w - n) * 4], 0, n * 4);
+        }
+    }
+    else if (_pX > 0 && _pX < w)
+    {
+        /* Also scrolling left (!), but the right columns are kept */
+        for (int y = 0; y < h; y++)
+        {
+            Uint8* row = &pixels[y * pitch];
+            SDL_memmove(row, &row[_pX * 4], (w - _pX) * 4);
+        }
+    }
+}
+
+void ScrollSurface( SDL_Surface* _src, int _pX, int _pY )
+{
+    SDL_BlendMode blend_mode;
+
+    SDL_GetSurfaceBlendMode(_src, &blend_mode);
+    if (_src->format->BytesPerPixel == 4
+    && !SDL_MUSTLOCK(_src)
+    && blend_mode == SDL_BLENDMODE_NONE
+    && blit_kernels != BlitKernels_SDL)
+    {
+        ScrollSurfaceInPlace(_src, _pX, _pY);
+        return;
+    }
+
+    ScrollSurfaceSlow(_src, _pX, _pY);
+}
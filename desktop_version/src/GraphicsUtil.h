@@ -2,17 +2,43 @@
 #define GRAPHICSUTIL_H
 
 #include <SDL.h>
+#include <vector>
 
 struct colourTransform
 {
     Uint32 colour;
 };
 
+/* A whole tile or sprite sheet kept in one surface, plus where each
+ * tile is on it: tile n is the nth square, left to right, top to bottom. */
+struct TileSheet
+{
+    SDL_Surface* surface;
+    std::vector<SDL_Rect> rects;
+    /* One word per row of each tile, if MakeTileSheetMasks() was called */
+    std::vector<Uint32> masks;
+
+    TileSheet(void) : surface(NULL) {}
+
+    size_t size(void) const
+    {
+        return rects.size();
+    }
+};
+
+void MakeTileSheet( TileSheet* sheet, SDL_Surface* image, int tile_square );
+
+void MakeTileSheetMasks( TileSheet* sheet );
+
+void FreeTileSheet( TileSheet* sheet );
+
 
 void setRect(SDL_Rect& _r, int x, int y, int w, int h);
 
 SDL_Surface* GetSubSurface( SDL_Surface* metaSurface, int x, int y, int width, int height );
 
+SDL_Surface* CopySubSurface( SDL_Surface* metaSurface, const SDL_Rect* area );
+
 Uint32 ReadPixel( SDL_Surface *surface, int x, int y );
 
 SDL_Surface * ScaleSurface( SDL_Surface *Surface, int Width, int Height, SDL_Surface * Dest = NULL );
@@ -23,6 +49,29 @@ void BlitSurfaceColoured( SDL_Surface* _src, SDL_Rect* _srcRect, SDL_Surface* _d
 
 void BlitSurfaceTinted( SDL_Surface* _src, SDL_Rect* _srcRect, SDL_Surface* _dest, SDL_Rect* _destRect, colourTransform& ct );
 
+/* What BlitSurfaceColoured(), BlitSurfaceTinted() and BlitTilesColoured()
+ * draw with. Auto uses the fastest direct kernels if they blend the same
+ * as SDL_BlitSurface() does here, else SDL. SDL also makes ScrollSurface()
+ * go through a temporary surface again. The rest are for -selftest and
+ * -benchmark. */
+enum BlitKernels
+{
+    BlitKernels_Auto,
+    BlitKernels_SDL,
+    BlitKernels_Scalar,
+    BlitKernels_SIMD
+};
+
+#ifdef SELFTEST
+void SetBlitKernels(enum BlitKernels kernels);
+#endif
+
+bool BlitDirectMatchesSDL(void);
+
+SDL_Surface* TintSurface( SDL_Surface* _src, colourTransform& ct );
+
+void BlitTilesColoured( SDL_Surface* _sheet, const SDL_Rect* _tiles, const SDL_Point* _positions, int count, int scale, bool flip, SDL_Surface* _dest, colourTransform& ct );
+
 void FillRect( SDL_Surface* surface, const int x, const int y, const int w, const int h, const int r, int g, int b );
 
 void FillRect( SDL_Surface* surface, const int r, int g, int b );
@@ -39,8 +88,14 @@ void ClearSurface(SDL_Surface* surface);
 
 void ScrollSurface(SDL_Surface* _src, int pX, int py);
 
+void ScrollRingSurface( SDL_Surface* _ring, int* origin, int _pY );
+
+void BlitSurfaceToRing( SDL_Surface* _src, SDL_Rect* _srcRect, SDL_Surface* _ring, int origin, const SDL_Rect* _destRect );
+
+void BlitScrolledRing( SDL_Surface* _ring, int origin, int _pY, const SDL_Rect* _srcRect, SDL_Surface* _dest );
+
 SDL_Surface * FlipSurfaceVerticle(SDL_Surface* _src);
 void UpdateFilter(void);
-SDL_Surface* ApplyFilter( SDL_Surface* _src );
+void ApplyFilter( SDL_Surface* _src, SDL_Surface* _dest );
 
 #endif /* GRAPHICSUTIL_H */
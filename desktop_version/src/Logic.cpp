@@ -805,10 +805,10 @@ void gamelogic(void)
                     int prevy = obj.entities[i].yp;
                     obj.disableblockat(prevx, prevy);
 
-                    bool entitygone = obj.updateentities(i);                // Behavioral logic
-                    if (entitygone) continue;
-                    obj.updateentitylogic(i);             // Basic Physics
-                    obj.entitymapcollision(i);            // Collisions with walls
+                    if (obj.stepentity(i))
+                    {
+                        continue;
+                    }
 
                     obj.moveblockto(prevx, prevy, obj.entities[i].xp, obj.entities[i].yp, obj.entities[i].w, obj.entities[i].h);
                     obj.movingplatformfix(i, obj.getplayer());
@@ -833,10 +833,10 @@ void gamelogic(void)
                     int prevy = obj.entities[ie].yp;
                     obj.disableblockat(prevx, prevy);
 
-                    bool entitygone = obj.updateentities(ie);                // Behavioral logic
-                    if (entitygone) continue;
-                    obj.updateentitylogic(ie);             // Basic Physics
-                    obj.entitymapcollision(ie);            // Collisions with walls
+                    if (obj.stepentity(ie))
+                    {
+                        continue;
+                    }
 
                     obj.moveblockto(prevx, prevy, obj.entities[ie].xp, obj.entities[ie].yp, obj.entities[ie].w, obj.entities[ie].h);
                 }
@@ -866,10 +866,7 @@ void gamelogic(void)
                     continue;
                 }
 
-                bool entitygone = obj.updateentities(ie);          // Behavioral logic
-                if (entitygone) continue;
-                obj.updateentitylogic(ie);       // Basic Physics
-                obj.entitymapcollision(ie);      // Collisions with walls
+                obj.stepentity(ie);
             }
 
             obj.entitycollisioncheck();         // Check ent v ent collisions, update states
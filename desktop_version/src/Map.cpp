@@ -66,6 +66,7 @@ mapclass::mapclass(void)
     resetmap();
 
     tileset = 0;
+    makecollision();
     initmapdata();
 
     resetnames();
@@ -675,59 +676,66 @@ void mapclass::settowercolour(int t)
 bool mapclass::spikecollide(int x, int y)
 {
     if (invincibility) return false;
-    if (tower.at(x,y,0)>= 6 && tower.at(x,y,0) <= 11) return true;
-    return false;
+    return tower.collisionat(x, y) & COLLIDE_SPIKE;
 }
 
 bool mapclass::collide(int x, int y)
 {
+    const int solid = invincibility ? COLLIDE_SOLID | COLLIDE_SPIKE : COLLIDE_SOLID;
+
     if (towermode)
     {
-        if (tower.at(x, y, 0) >= 12 && tower.at(x, y, 0) <= 27) return true;
-        if (invincibility)
-        {
-            if (tower.at(x, y, 0) >= 6 && tower.at(x, y, 0) <= 11) return true;
-        }
+        return tower.collisionat(x, y) & solid;
+    }
+
+    if (x < -1 || y < -1 || x > 40 || y > 30)
+    {
+        return false;
+    }
+    return collision[(x + 1) + (y + 1) * 42] & solid;
+}
+
+int mapclass::tilecollision(int x, int y)
+{
+    //Off the edge of the room counts as the edge of the room
+    if (y == -1) return tilecollision(x, y + 1);
+    if (y == 29+extrarow) return tilecollision(x, y - 1);
+    if (x == -1) return tilecollision(x + 1, y);
+    if (x == 40) return tilecollision(x - 1, y);
+    if (x < 0 || y < 0 || x >= 40 || y >= 29+extrarow) return 0;
+
+    const int tile = contents[TILE_IDX(x, y)];
+    int flags = 0;
+    if (tileset == 2)
+    {
+        if (tile >= 12 && tile <= 27) flags |= COLLIDE_SOLID;
+        if (tile >= 6 && tile <= 11) flags |= COLLIDE_SPIKE;
     }
-    else if (tileset == 2)
+    else
     {
-        int tile;
-        if (y == -1) return collide(x, y + 1);
-        if (y == 29+extrarow) return collide(x, y - 1);
-        if (x == -1) return collide(x + 1, y);
-        if (x == 40) return collide(x - 1, y);
-        if (x < 0 || y < 0 || x >= 40 || y >= 29 + extrarow) return false;
-        tile = contents[TILE_IDX(x, y)];
-        if (tile >= 12 && tile <= 27) return true;
-        if (invincibility)
+        if (tile == 1) flags |= COLLIDE_SOLID;
+        if (tileset==0 && tile == 59) flags |= COLLIDE_SOLID;
+        if (tile>= 80 && tile < 680) flags |= COLLIDE_SOLID;
+        if (tile == 740 && tileset==1) flags |= COLLIDE_SOLID;
+        if (tile>= 6 && tile <= 9) flags |= COLLIDE_SPIKE;
+        if (tile>= 49 && tile <= 50) flags |= COLLIDE_SPIKE;
+        if (tileset == 1)
         {
-            if (tile >= 6 && tile <= 11) return true;
+            if (tile>= 49 && tile < 80) flags |= COLLIDE_SPIKE;
         }
     }
-    else
+    return flags;
+}
+
+void mapclass::makecollision(void)
+{
+    for (int y = -1; y <= 30; y++)
     {
-        int tile;
-        if (y == -1) return collide(x, y + 1);
-        if (y == 29+extrarow) return collide(x, y - 1);
-        if (x == -1) return collide(x + 1, y);
-        if (x == 40) return collide(x - 1, y);
-        if (x < 0 || y < 0 || x >= 40 || y >= 29+extrarow) return false;
-        tile = contents[TILE_IDX(x, y)];
-        if (tile == 1) return true;
-        if (tileset==0 && tile == 59) return true;
-        if (tile>= 80 && tile < 680) return true;
-        if (tile == 740 && tileset==1) return true;
-        if (invincibility)
+        for (int x = -1; x <= 40; x++)
         {
-            if (tile>= 6 && tile <= 9) return true;
-            if (tile>= 49 && tile <= 50) return true;
-            if (tileset == 1)
-            {
-                if (tile>= 49 && tile < 80) return true;
-            }
+            collision[(x + 1) + (y + 1) * 42] = tilecollision(x, y);
         }
     }
-    return false;
 }
 
 void mapclass::settile(int xp, int yp, int t)
@@ -735,6 +743,15 @@ void mapclass::settile(int xp, int yp, int t)
     if (xp >= 0 && xp < 40 && yp >= 0 && yp < 29+extrarow)
     {
         contents[TILE_IDX(xp, yp)] = t;
+
+        //Update this tile, and the border if it's on the edge
+        for (int y = yp - 1; y <= yp + 1; y++)
+        {
+            for (int x = xp - 1; x <= xp + 1; x++)
+            {
+                collision[(x + 1) + (y + 1) * 42] = tilecollision(x, y);
+            }
+        }
     }
 }
 
@@ -1363,6 +1380,9 @@ void mapclass::loadlevel(int rx, int ry)
     towermode = false;
     ypos = 0;
     oldypos = 0;
+    /* collision[] is left as the old room's until makecollision() at the
+     * end of this function. contents and tileset change below as well, and
+     * nothing before that point reads collision[]. */
     extrarow = 0;
     spikeleveltop = 0;
     spikelevelbottom = 0;
@@ -1980,6 +2000,8 @@ void mapclass::loadlevel(int rx, int ry)
     }
 #endif
     }
+    makecollision();
+
     //The room's loaded: now we fill out damage blocks based on the tiles.
     if (towermode)
     {
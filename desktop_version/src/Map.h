@@ -63,6 +63,9 @@ public:
 
     bool collide(int x, int y);
 
+    int tilecollision(int x, int y);
+    void makecollision(void);
+
     void settile(int xp, int yp, int t);
 
 
@@ -94,6 +97,9 @@ public:
     int roomdeathsfinal[20 * 20];
     static const int areamap[20 * 20];
     int contents[40 * 30];
+    /* COLLIDE_* flags of contents for collide(), with a border a tile
+     * wide that repeats the edge of the room */
+    unsigned char collision[42 * 32];
     bool explored[20 * 20];
 
     bool isexplored(const int rx, const int ry);
@@ -200,6 +200,10 @@ end:
 
     static void Pause()
     {
+        if (voices == NULL)
+        {
+            return;
+        }
         for (size_t i = 0; i < VVV_MAX_CHANNELS; i++)
         {
             FAudioSourceVoice_Stop(voices[i], 0, FAUDIO_COMMIT_NOW);
@@ -208,6 +212,10 @@ end:
 
     static void Resume()
     {
+        if (voices == NULL)
+        {
+            return;
+        }
         for (size_t i = 0; i < VVV_MAX_CHANNELS; i++)
         {
             FAudioSourceVoice_Start(voices[i], 0, FAUDIO_COMMIT_NOW);
@@ -230,6 +238,10 @@ end:
     static void SetVolume(int soundVolume)
     {
         float adj_vol = (float) soundVolume / VVV_MAX_VOLUME;
+        if (voices == NULL)
+        {
+            return;
+        }
         for (size_t i = 0; i < VVV_MAX_CHANNELS; i++)
         {
             FAudioVoice_SetVolume(voices[i], adj_vol, FAUDIO_COMMIT_NOW);
@@ -587,11 +599,18 @@ musicclass::musicclass(void)
     nicefade = false;
     quick_fade = true;
 
+    headless = false;
+
     usingmmmmmm = false;
 }
 
 void musicclass::init(void)
 {
+    if (headless)
+    {
+        return;
+    }
+
     if (FAudioCreate(&faudioctx, 0, FAUDIO_DEFAULT_PROCESSOR))
     {
         vlog_error("Unable to initialize FAudio");
@@ -805,7 +824,7 @@ void musicclass::play(int t)
 
     currentsong = t;
 
-    if (t == -1)
+    if (t == -1 || headless)
     {
         return;
     }
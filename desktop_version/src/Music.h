@@ -59,6 +59,10 @@ public:
 
     bool quick_fade;
 
+    /* No audio device: init() loads nothing, and play() only keeps track of
+     * which song would be playing */
+    bool headless;
+
     // MMMMMM mod settings
     bool mmmmmm;
     bool usingmmmmmm;
@@ -26,10 +26,30 @@ void Screen::init(const struct ScreenSettings* settings)
     m_renderer = NULL;
     m_screenTexture = NULL;
     m_screen = NULL;
+    m_filterBuffer = NULL;
     isWindowed = !settings->fullscreen;
     scalingMode = settings->scalingMode;
     isFiltered = settings->linearFilter;
     vsync = settings->useVsync;
+    badSignalEffect = settings->badSignal;
+
+    // FIXME: This surface should be the actual backbuffer! -flibit
+    m_screen = SDL_CreateRGBSurface(
+        0,
+        SCREEN_WIDTH_PIXELS,
+        SCREEN_HEIGHT_PIXELS,
+        32,
+        0x00FF0000,
+        0x0000FF00,
+        0x000000FF,
+        0xFF000000
+    );
+
+    if (headless)
+    {
+        /* No window; graphics still needs m_screen for its pixel format */
+        return;
+    }
 
     SDL_SetHintWithPriority(
         SDL_HINT_RENDER_SCALE_QUALITY,
@@ -55,8 +75,15 @@ void Screen::init(const struct ScreenSettings* settings)
 
     LoadIcon();
 
-    // FIXME: This surface should be the actual backbuffer! -flibit
-    m_screen = SDL_CreateRGBSurface(
+    m_screenTexture = SDL_CreateTexture(
+        m_renderer,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_TEXTUREACCESS_STREAMING,
+        SCREEN_WIDTH_PIXELS,
+        SCREEN_HEIGHT_PIXELS
+    );
+    // The bad signal filter renders into this, instead of a new surface every frame
+    m_filterBuffer = SDL_CreateRGBSurface(
         0,
         SCREEN_WIDTH_PIXELS,
         SCREEN_HEIGHT_PIXELS,
@@ -66,15 +93,7 @@ void Screen::init(const struct ScreenSettings* settings)
         0x000000FF,
         0xFF000000
     );
-    m_screenTexture = SDL_CreateTexture(
-        m_renderer,
-        SDL_PIXELFORMAT_ARGB8888,
-        SDL_TEXTUREACCESS_STREAMING,
-        SCREEN_WIDTH_PIXELS,
-        SCREEN_HEIGHT_PIXELS
-    );
-
-    badSignalEffect = settings->badSignal;
+    SDL_SetSurfaceBlendMode(m_filterBuffer, SDL_BLENDMODE_NONE);
 
     ResizeScreen(settings->windowWidth, settings->windowHeight);
 }
@@ -87,6 +106,7 @@ void Screen::destroy(void)
 
     /* Order matters! */
     X(SDL_DestroyTexture, m_screenTexture);
+    X(SDL_FreeSurface, m_filterBuffer);
     X(SDL_FreeSurface, m_screen);
     X(SDL_DestroyRenderer, m_renderer);
     X(SDL_DestroyWindow, m_window);
@@ -253,6 +273,13 @@ void Screen::ResizeToNearestMultiple(void)
 
 void Screen::GetWindowSize(int* x, int* y)
 {
+    if (headless)
+    {
+        *x = SCREEN_WIDTH_PIXELS;
+        *y = SCREEN_HEIGHT_PIXELS;
+        return;
+    }
+
     if (SDL_GetRendererOutputSize(m_renderer, x, y) != 0)
     {
         vlog_error("Could not get window size: %s", SDL_GetError());
@@ -269,20 +296,17 @@ void Screen::UpdateScreen(SDL_Surface* buffer, SDL_Rect* rect )
         return;
     }
 
-    if(badSignalEffect)
+    /* The filter buffer may have failed to be created, and headless runs
+     * never make one; show the frame unfiltered then */
+    if (badSignalEffect && m_filterBuffer != NULL)
     {
-        buffer = ApplyFilter(buffer);
+        ApplyFilter(buffer, m_filterBuffer);
+        buffer = m_filterBuffer;
     }
 
 
     ClearSurface(m_screen);
     BlitSurfaceStandard(buffer,NULL,m_screen,rect);
-
-    if(badSignalEffect)
-    {
-        SDL_FreeSurface(buffer);
-    }
-
 }
 
 const SDL_PixelFormat* Screen::GetFormat(void)
@@ -36,11 +36,13 @@ public:
     bool badSignalEffect;
     int scalingMode;
     bool vsync;
+    bool headless;
 
     SDL_Window *m_window;
     SDL_Renderer *m_renderer;
     SDL_Texture *m_screenTexture;
     SDL_Surface* m_screen;
+    SDL_Surface* m_filterBuffer;
 };
 
 #ifndef GAMESCREEN_DEFINITION
@@ -21,8 +21,11 @@
 scriptclass::scriptclass(void)
 {
     position = 0;
+    builtinlines = NULL;
+    numbuiltinlines = 0;
     scriptdelay = 0;
     running = false;
+    fixedseed = false;
 
     b = 0;
     g = 0;
@@ -40,45 +43,321 @@ scriptclass::scriptclass(void)
 void scriptclass::clearcustom(void)
 {
     customscripts.clear();
+    customscript_index.clear();
+}
+
+static Uint32 hashscriptname(const std::string& name)
+{
+    return fnv1a(FNV1A_BASIS, name.data(), name.length());
+}
+
+static void indexcustomscript(
+    std::vector<int>& index,
+    const std::vector<Script>& scripts,
+    const int i
+) {
+    const size_t mask = index.size() - 1;
+    for (size_t slot = hashscriptname(scripts[i].name) & mask; ; slot = (slot + 1) & mask)
+    {
+        if (index[slot] == -1)
+        {
+            index[slot] = i;
+            return;
+        }
+        if (scripts[index[slot]].name == scripts[i].name)
+        {
+            /* Keep the earlier one */
+            return;
+        }
+    }
+}
+
+void scriptclass::reindexcustomscripts(void)
+{
+    size_t size = 16;
+    while (size < customscripts.size() * 2)
+    {
+        size *= 2;
+    }
+
+    customscript_index.assign(size, -1);
+    for (size_t i = 0; i < customscripts.size(); i++)
+    {
+        indexcustomscript(customscript_index, customscripts, i);
+    }
+}
+
+void scriptclass::addcustomscript(const Script& script_)
+{
+    customscripts.push_back(script_);
+
+    if (customscripts.size() * 2 > customscript_index.size())
+    {
+        reindexcustomscripts();
+    }
+    else
+    {
+        indexcustomscript(customscript_index, customscripts, customscripts.size() - 1);
+    }
+}
+
+void scriptclass::removecustomscript(const std::string& name)
+{
+    /* Removes every script called name.
+     * When this loop reaches the end, it wraps to SIZE_MAX; SIZE_MAX + 1 is 0 */
+    bool removed = false;
+    size_t i;
+    for (i = customscripts.size() - 1; i + 1 > 0; --i)
+    {
+        if (customscripts[i].name == name)
+        {
+            customscripts.erase(customscripts.begin() + i);
+            removed = true;
+        }
+    }
+
+    /* Everything after a removed script has moved down */
+    if (removed)
+    {
+        reindexcustomscripts();
+    }
+}
+
+/* Returns the index in customscripts of the first script called name, or -1 */
+int scriptclass::findcustomscript(const std::string& name)
+{
+    if (customscript_index.empty())
+    {
+        return -1;
+    }
+
+    const size_t mask = customscript_index.size() - 1;
+    for (size_t slot = hashscriptname(name) & mask; ; slot = (slot + 1) & mask)
+    {
+        const int i = customscript_index[slot];
+        if (i == -1 || customscripts[i].name == name)
+        {
+            return i;
+        }
+    }
 }
 
 static bool argexists[NUM_SCRIPT_ARGS];
 static std::string raw_words[NUM_SCRIPT_ARGS];
 
-void scriptclass::tokenize( const std::string& t )
+/* Every command run() knows, in strcmp() order so they can be binary
+ * searched. tokenize() looks up words[0] here once, and run() compares the
+ * result instead of comparing strings against each command in turn. */
+#define SCRIPT_COMMANDS \
+    FOREACH_COMMAND(activateteleporter) \
+    FOREACH_COMMAND(activeteleporter) \
+    FOREACH_COMMAND(alarmoff) \
+    FOREACH_COMMAND(alarmon) \
+    FOREACH_COMMAND(altstates) \
+    FOREACH_COMMAND(audiopause) \
+    FOREACH_COMMAND(backgroundtext) \
+    FOREACH_COMMAND(befadein) \
+    FOREACH_COMMAND(blackon) \
+    FOREACH_COMMAND(blackout) \
+    FOREACH_COMMAND(bluecontrol) \
+    FOREACH_COMMAND(changeai) \
+    FOREACH_COMMAND(changecolour) \
+    FOREACH_COMMAND(changecustommood) \
+    FOREACH_COMMAND(changedir) \
+    FOREACH_COMMAND(changegravity) \
+    FOREACH_COMMAND(changemood) \
+    FOREACH_COMMAND(changeplayercolour) \
+    FOREACH_COMMAND(changerespawncolour) \
+    FOREACH_COMMAND(changetile) \
+    FOREACH_COMMAND(clearteleportscript) \
+    FOREACH_COMMAND(companion) \
+    FOREACH_COMMAND(createactivityzone) \
+    FOREACH_COMMAND(createcrewman) \
+    FOREACH_COMMAND(createentity) \
+    FOREACH_COMMAND(createlastrescued) \
+    FOREACH_COMMAND(createrescuedcrew) \
+    FOREACH_COMMAND(customifflag) \
+    FOREACH_COMMAND(customiftrinkets) \
+    FOREACH_COMMAND(customiftrinketsless) \
+    FOREACH_COMMAND(custommap) \
+    FOREACH_COMMAND(customposition) \
+    FOREACH_COMMAND(cutscene) \
+    FOREACH_COMMAND(delay) \
+    FOREACH_COMMAND(destroy) \
+    FOREACH_COMMAND(do) \
+    FOREACH_COMMAND(endcutscene) \
+    FOREACH_COMMAND(endtext) \
+    FOREACH_COMMAND(endtextfast) \
+    FOREACH_COMMAND(entersecretlab) \
+    FOREACH_COMMAND(everybodysad) \
+    FOREACH_COMMAND(face) \
+    FOREACH_COMMAND(fadein) \
+    FOREACH_COMMAND(fadeout) \
+    FOREACH_COMMAND(finalmode) \
+    FOREACH_COMMAND(flag) \
+    FOREACH_COMMAND(flash) \
+    FOREACH_COMMAND(flip) \
+    FOREACH_COMMAND(flipgravity) \
+    FOREACH_COMMAND(flipme) \
+    FOREACH_COMMAND(foundlab) \
+    FOREACH_COMMAND(foundlab2) \
+    FOREACH_COMMAND(foundtrinket) \
+    FOREACH_COMMAND(gamemode) \
+    FOREACH_COMMAND(gamestate) \
+    FOREACH_COMMAND(gotoposition) \
+    FOREACH_COMMAND(gotoroom) \
+    FOREACH_COMMAND(greencontrol) \
+    FOREACH_COMMAND(hascontrol) \
+    FOREACH_COMMAND(hidecoordinates) \
+    FOREACH_COMMAND(hideplayer) \
+    FOREACH_COMMAND(hidesecretlab) \
+    FOREACH_COMMAND(hideship) \
+    FOREACH_COMMAND(hidetargets) \
+    FOREACH_COMMAND(hideteleporters) \
+    FOREACH_COMMAND(hidetrinkets) \
+    FOREACH_COMMAND(ifcrewlost) \
+    FOREACH_COMMAND(ifexplored) \
+    FOREACH_COMMAND(ifflag) \
+    FOREACH_COMMAND(iflast) \
+    FOREACH_COMMAND(ifskip) \
+    FOREACH_COMMAND(iftrinkets) \
+    FOREACH_COMMAND(iftrinketsless) \
+    FOREACH_COMMAND(ifwarp) \
+    FOREACH_COMMAND(jukebox) \
+    FOREACH_COMMAND(leavesecretlab) \
+    FOREACH_COMMAND(loadscript) \
+    FOREACH_COMMAND(loop) \
+    FOREACH_COMMAND(missing) \
+    FOREACH_COMMAND(moveplayer) \
+    FOREACH_COMMAND(musicfadein) \
+    FOREACH_COMMAND(musicfadeout) \
+    FOREACH_COMMAND(nocontrol) \
+    FOREACH_COMMAND(play) \
+    FOREACH_COMMAND(playef) \
+    FOREACH_COMMAND(position) \
+    FOREACH_COMMAND(purplecontrol) \
+    FOREACH_COMMAND(redcontrol) \
+    FOREACH_COMMAND(rescued) \
+    FOREACH_COMMAND(resetgame) \
+    FOREACH_COMMAND(restoreplayercolour) \
+    FOREACH_COMMAND(resumemusic) \
+    FOREACH_COMMAND(rollcredits) \
+    FOREACH_COMMAND(setactivitycolour) \
+    FOREACH_COMMAND(setactivityposition) \
+    FOREACH_COMMAND(setactivitytext) \
+    FOREACH_COMMAND(setcheckpoint) \
+    FOREACH_COMMAND(shake) \
+    FOREACH_COMMAND(showcoordinates) \
+    FOREACH_COMMAND(showplayer) \
+    FOREACH_COMMAND(showsecretlab) \
+    FOREACH_COMMAND(showship) \
+    FOREACH_COMMAND(showtargets) \
+    FOREACH_COMMAND(showteleporters) \
+    FOREACH_COMMAND(showtrinkets) \
+    FOREACH_COMMAND(speak) \
+    FOREACH_COMMAND(speak_active) \
+    FOREACH_COMMAND(specialline) \
+    FOREACH_COMMAND(squeak) \
+    FOREACH_COMMAND(startintermission2) \
+    FOREACH_COMMAND(stopmusic) \
+    FOREACH_COMMAND(teleportscript) \
+    FOREACH_COMMAND(telesave) \
+    FOREACH_COMMAND(text) \
+    FOREACH_COMMAND(textboxactive) \
+    FOREACH_COMMAND(tofloor) \
+    FOREACH_COMMAND(trinketbluecontrol) \
+    FOREACH_COMMAND(trinketscriptmusic) \
+    FOREACH_COMMAND(trinketyellowcontrol) \
+    FOREACH_COMMAND(undovvvvvvman) \
+    FOREACH_COMMAND(untilbars) \
+    FOREACH_COMMAND(untilfade) \
+    FOREACH_COMMAND(vvvvvvman) \
+    FOREACH_COMMAND(walk) \
+    FOREACH_COMMAND(warpdir) \
+    FOREACH_COMMAND(yellowcontrol) \
+
+enum ScriptCommand
 {
-    j = 0;
-    std::string tempword;
-    std::string temprawword;
-    char currentletter;
+#define FOREACH_COMMAND(NAME) Command_##NAME,
+    SCRIPT_COMMANDS
+#undef FOREACH_COMMAND
+    Command_NUM,
+    Command_none = Command_NUM
+};
 
-    SDL_zeroa(argexists);
+static const char* const commandnames[] = {
+#define FOREACH_COMMAND(NAME) #NAME,
+    SCRIPT_COMMANDS
+#undef FOREACH_COMMAND
+};
+
+SDL_COMPILE_TIME_ASSERT(commandnames, SDL_arraysize(commandnames) == Command_NUM);
 
-    for (size_t i = 0; i < t.length(); i++)
+static enum ScriptCommand command = Command_none;
+
+static enum ScriptCommand lookupcommand(const std::string& word)
+{
+    size_t lo = 0;
+    size_t hi = Command_NUM;
+    while (lo < hi)
     {
-        currentletter = t[i];
-        if (currentletter == '(' || currentletter == ')' || currentletter == ',')
+        const size_t mid = (lo + hi) / 2;
+        const int cmp = SDL_strcmp(word.c_str(), commandnames[mid]);
+        if (cmp == 0)
         {
-            words[j] = tempword;
-            raw_words[j] = temprawword;
-            argexists[j] = words[j] != "";
-            for (size_t ii = 0; ii < words[j].length(); ii++)
-            {
-                words[j][ii] = SDL_tolower(words[j][ii]);
-            }
-            j++;
-            tempword = "";
-            temprawword = "";
+            return (enum ScriptCommand) mid;
         }
-        else if (currentletter == ' ')
+        if (cmp < 0)
         {
-            /* Ignore spaces unless it's part of a script name. */
-            temprawword += currentletter;
+            hi = mid;
         }
         else
         {
-            tempword += currentletter;
-            temprawword += currentletter;
+            lo = mid + 1;
+        }
+    }
+    return Command_none;
+}
+
+/* Sets word to t[start, end) with the spaces taken out. clear() and += keep
+ * whatever buffer word already has, so once the words have grown to fit,
+ * tokenizing doesn't allocate. */
+static void copyword(
+    std::string& word,
+    const char* t,
+    const size_t start,
+    const size_t end,
+    const bool lower
+) {
+    word.clear();
+    for (size_t i = start; i < end; i++)
+    {
+        if (t[i] != ' ')
+        {
+            word += lower ? SDL_tolower(t[i]) : t[i];
+        }
+    }
+}
+
+void scriptclass::tokenize(const char* t)
+{
+    const size_t length = SDL_strlen(t);
+    j = 0;
+    size_t wordstart = 0;
+
+    SDL_zeroa(argexists);
+
+    for (size_t i = 0; i < length; i++)
+    {
+        const char currentletter = t[i];
+        if (currentletter == '(' || currentletter == ')' || currentletter == ',')
+        {
+            copyword(words[j], t, wordstart, i, true);
+            /* Spaces are kept here, since they can be part of a script name */
+            raw_words[j].assign(t + wordstart, i - wordstart);
+            argexists[j] = !words[j].empty();
+            j++;
+            wordstart = i + 1;
         }
         if (j >= (int) SDL_arraysize(words))
         {
@@ -88,16 +367,38 @@ void scriptclass::tokenize( const std::string& t )
 
     if (j < (int) SDL_arraysize(words))
     {
-        const bool lastargexists = tempword != "";
+        bool lastargexists = false;
+        for (size_t i = wordstart; i < length; i++)
+        {
+            if (t[i] != ' ')
+            {
+                lastargexists = true;
+                break;
+            }
+        }
         if (lastargexists)
         {
-            words[j] = tempword;
-            raw_words[j] = tempword;
+            copyword(words[j], t, wordstart, length, false);
+            raw_words[j] = words[j];
         }
         argexists[j] = lastargexists;
     }
+
+    command = lookupcommand(words[0]);
+}
+
+#ifdef SELFTEST
+const std::string& scriptclass::getrawword(const int index)
+{
+    return raw_words[index];
 }
 
+bool scriptclass::getargexists(const int index)
+{
+    return argexists[index];
+}
+#endif
+
 static int getcolorfromname(std::string name)
 {
     if      (name == "player")     return CYAN;
@@ -125,6 +426,24 @@ static int getcrewmanfromname(std::string name)
 }
 
 
+const char* scriptclass::getcommand(const int index)
+{
+    if (builtinlines != NULL)
+    {
+        if (index < 0 || (size_t) index >= numbuiltinlines)
+        {
+            return NULL;
+        }
+        return builtinlines[index];
+    }
+
+    if (!INBOUNDS_VEC(index, commands))
+    {
+        return NULL;
+    }
+    return commands[index].c_str();
+}
+
 void scriptclass::run(void)
 {
     if (!running)
@@ -136,10 +455,11 @@ void scriptclass::run(void)
     short execution_counter = 0;
     while(running && scriptdelay<=0 && !game.pausescript)
     {
-        if (INBOUNDS_VEC(position, commands))
+        const char* line = getcommand(position);
+        if (line != NULL)
         {
             //Let's split or command in an array of words
-            tokenize(commands[position]);
+            tokenize(line);
 
             //For script assisted input
             game.press_left = false;
@@ -148,7 +468,7 @@ void scriptclass::run(void)
             game.press_map = false;
 
             //Ok, now we run a command based on that string
-            if (words[0] == "moveplayer")
+            if (command == Command_moveplayer)
             {
                 //USAGE: moveplayer(x offset, y offset)
                 int player = obj.getplayer();
@@ -162,7 +482,7 @@ void scriptclass::run(void)
                 scriptdelay = 1;
             }
 #if !defined(NO_CUSTOM_LEVELS)
-            if (words[0] == "warpdir")
+            if (command == Command_warpdir)
             {
                 int temprx=ss_toi(words[1])-1;
                 int tempry=ss_toi(words[2])-1;
@@ -202,7 +522,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            if (words[0] == "ifwarp")
+            if (command == Command_ifwarp)
             {
                 const RoomProperty* const room = cl.getroomprop(ss_toi(words[1])-1, ss_toi(words[2])-1);
                 if (room->warpdir == ss_toi(words[3]))
@@ -212,7 +532,7 @@ void scriptclass::run(void)
                 }
             }
 #endif
-            if (words[0] == "destroy")
+            if (command == Command_destroy)
             {
                 if(words[1]=="gravitylines"){
                     for(size_t edi=0; edi<obj.entities.size(); edi++){
@@ -236,7 +556,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            if (words[0] == "customiftrinkets")
+            if (command == Command_customiftrinkets)
             {
                 if (game.trinkets() >= ss_toi(words[1]))
                 {
@@ -244,7 +564,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            if (words[0] == "customiftrinketsless")
+            if (command == Command_customiftrinketsless)
             {
                 if (game.trinkets() < ss_toi(words[1]))
                 {
@@ -252,7 +572,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "customifflag")
+            else if (command == Command_customifflag)
             {
                 int flag = ss_toi(words[1]);
                 if (INBOUNDS_ARR(flag, obj.flags) && obj.flags[flag])
@@ -261,7 +581,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            if (words[0] == "custommap")
+            if (command == Command_custommap)
             {
                 if(words[1]=="on"){
                     map.customshowmm=true;
@@ -269,12 +589,12 @@ void scriptclass::run(void)
                     map.customshowmm=false;
                 }
             }
-            if (words[0] == "delay")
+            if (command == Command_delay)
             {
                 //USAGE: delay(frames)
                 scriptdelay = ss_toi(words[1]);
             }
-            if (words[0] == "flag")
+            if (command == Command_flag)
             {
                 int flag = ss_toi(words[1]);
                 if (INBOUNDS_ARR(flag, obj.flags))
@@ -289,17 +609,17 @@ void scriptclass::run(void)
                     }
                 }
             }
-            if (words[0] == "flash")
+            if (command == Command_flash)
             {
                 //USAGE: flash(frames)
                 game.flashlight = ss_toi(words[1]);
             }
-            if (words[0] == "shake")
+            if (command == Command_shake)
             {
                 //USAGE: shake(frames)
                 game.screenshake = ss_toi(words[1]);
             }
-            if (words[0] == "walk")
+            if (command == Command_walk)
             {
                 //USAGE: walk(dir,frames)
                 if (words[1] == "left")
@@ -312,12 +632,12 @@ void scriptclass::run(void)
                 }
                 scriptdelay = ss_toi(words[2]);
             }
-            if (words[0] == "flip")
+            if (command == Command_flip)
             {
                 game.press_action = true;
                 scriptdelay = 1;
             }
-            if (words[0] == "tofloor")
+            if (command == Command_tofloor)
             {
                 int player = obj.getplayer();
                 if(INBOUNDS_VEC(player, obj.entities) && obj.entities[player].onroof>0)
@@ -326,35 +646,35 @@ void scriptclass::run(void)
                     scriptdelay = 1;
                 }
             }
-            if (words[0] == "playef")
+            if (command == Command_playef)
             {
                 music.playef(ss_toi(words[1]));
             }
-            if (words[0] == "play")
+            if (command == Command_play)
             {
                 music.play(ss_toi(words[1]));
             }
-            if (words[0] == "stopmusic")
+            if (command == Command_stopmusic)
             {
                 music.haltdasmusik();
             }
-            if (words[0] == "resumemusic")
+            if (command == Command_resumemusic)
             {
                 music.resumefade(0);
             }
-            if (words[0] == "musicfadeout")
+            if (command == Command_musicfadeout)
             {
                 music.fadeout(false);
             }
-            if (words[0] == "musicfadein")
+            if (command == Command_musicfadein)
             {
                 music.fadein();
             }
-            if (words[0] == "trinketscriptmusic")
+            if (command == Command_trinketscriptmusic)
             {
                 music.play(4);
             }
-            if (words[0] == "gotoposition")
+            if (command == Command_gotoposition)
             {
                 //USAGE: gotoposition(x position, y position, gravity position)
                 int player = obj.getplayer();
@@ -368,20 +688,20 @@ void scriptclass::run(void)
                 game.gravitycontrol = ss_toi(words[3]);
 
             }
-            if (words[0] == "gotoroom")
+            if (command == Command_gotoroom)
             {
                 //USAGE: gotoroom(x,y) (manually add 100)
                 map.gotoroom(ss_toi(words[1])+100, ss_toi(words[2])+100);
             }
-            if (words[0] == "cutscene")
+            if (command == Command_cutscene)
             {
                 graphics.showcutscenebars = true;
             }
-            if (words[0] == "endcutscene")
+            if (command == Command_endcutscene)
             {
                 graphics.showcutscenebars = false;
             }
-            if (words[0] == "audiopause")
+            if (command == Command_audiopause)
             {
                 if (words[1] == "on")
                 {
@@ -392,7 +712,7 @@ void scriptclass::run(void)
                     game.disabletemporaryaudiopause = true;
                 }
             }
-            if (words[0] == "untilbars")
+            if (command == Command_untilbars)
             {
                 if (graphics.showcutscenebars)
                 {
@@ -411,7 +731,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            else if (words[0] == "text")
+            else if (command == Command_text)
             {
                 //oh boy
                 //first word is the colour.
@@ -498,13 +818,14 @@ void scriptclass::run(void)
                 for (int i = 0; i < ss_toi(words[4]); i++)
                 {
                     position++;
-                    if (INBOUNDS_VEC(position, commands))
+                    const char* text = getcommand(position);
+                    if (text != NULL)
                     {
-                        txt.push_back(commands[position]);
+                        txt.push_back(text);
                     }
                 }
             }
-            else if (words[0] == "position")
+            else if (command == Command_position)
             {
                 //are we facing left or right? for some objects we don't care, default at 0.
                 j = 0;
@@ -566,7 +887,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            else if (words[0] == "customposition")
+            else if (command == Command_customposition)
             {
                 //are we facing left or right? for some objects we don't care, default at 0.
                 j = 0;
@@ -663,15 +984,15 @@ void scriptclass::run(void)
                     }
                 }
             }
-            else if (words[0] == "backgroundtext")
+            else if (command == Command_backgroundtext)
             {
                 game.backgroundtext = true;
             }
-            else if (words[0] == "flipme")
+            else if (command == Command_flipme)
             {
                 textflipme = !textflipme;
             }
-            else if (words[0] == "speak_active" || words[0] == "speak")
+            else if (command == Command_speak_active || command == Command_speak)
             {
                 //Ok, actually display the textbox we've initilised now!
                 //If using "speak", don't make the textbox active (so we can use multiple textboxes)
@@ -710,7 +1031,7 @@ void scriptclass::run(void)
                 }
 
                 graphics.textboxadjust();
-                if (words[0] == "speak_active")
+                if (command == Command_speak_active)
                 {
                     graphics.textboxactive();
                 }
@@ -725,25 +1046,25 @@ void scriptclass::run(void)
                 }
                 game.backgroundtext = false;
             }
-            else if (words[0] == "endtext")
+            else if (command == Command_endtext)
             {
                 graphics.textboxremove();
                 game.hascontrol = true;
                 game.advancetext = false;
             }
-            else if (words[0] == "endtextfast")
+            else if (command == Command_endtextfast)
             {
                 graphics.textboxremovefast();
                 game.hascontrol = true;
                 game.advancetext = false;
             }
-            else if (words[0] == "do")
+            else if (command == Command_do)
             {
                 //right, loop from this point
                 looppoint = position;
                 loopcount = ss_toi(words[1]);
             }
-            else if (words[0] == "loop")
+            else if (command == Command_loop)
             {
                 //right, loop from this point
                 loopcount--;
@@ -752,7 +1073,7 @@ void scriptclass::run(void)
                     position = looppoint;
                 }
             }
-            else if (words[0] == "vvvvvvman")
+            else if (command == Command_vvvvvvman)
             {
                 //Create the super VVVVVV combo!
                 i = obj.getplayer();
@@ -767,7 +1088,7 @@ void scriptclass::run(void)
                     obj.entities[i].h = 126-80;// 21;
                 }
             }
-            else if (words[0] == "undovvvvvvman")
+            else if (command == Command_undovvvvvvman)
             {
                 //Create the super VVVVVV combo!
                 i = obj.getplayer();
@@ -781,7 +1102,7 @@ void scriptclass::run(void)
                     obj.entities[i].h = 21;
                 }
             }
-            else if (words[0] == "createentity")
+            else if (command == Command_createentity)
             {
                 std::string word6 = words[6];
                 std::string word7 = words[7];
@@ -807,7 +1128,7 @@ void scriptclass::run(void)
                 words[8] = word8;
                 words[9] = word9;
             }
-            else if (words[0] == "createcrewman")
+            else if (command == Command_createcrewman)
             {
                 // Note: Do not change the "r" variable, it's used in custom levels
                 // to have glitchy textbox colors, where the game treats the value
@@ -854,7 +1175,7 @@ void scriptclass::run(void)
                     obj.createentity(ss_toi(words[1]), ss_toi(words[2]), 18, r, ss_toi(words[4]), ss_toi(words[5]));
                 }
             }
-            else if (words[0] == "changemood")
+            else if (command == Command_changemood)
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -868,7 +1189,7 @@ void scriptclass::run(void)
                     obj.entities[i].tile = 144;
                 }
             }
-            else if (words[0] == "changecustommood")
+            else if (command == Command_changecustommood)
             {
                 if (words[1] == "player")
                 {
@@ -925,7 +1246,7 @@ void scriptclass::run(void)
                     obj.entities[i].tile = 144;
                 }
             }
-            else if (words[0] == "changetile")
+            else if (command == Command_changetile)
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -935,7 +1256,7 @@ void scriptclass::run(void)
                     obj.entities[i].tile = ss_toi(words[2]);
                 }
             }
-            else if (words[0] == "flipgravity")
+            else if (command == Command_flipgravity)
             {
                 //not something I'll use a lot, I think. Doesn't need to be very robust!
                 if (words[1] == "player")
@@ -960,7 +1281,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            else if (words[0] == "changegravity")
+            else if (command == Command_changegravity)
             {
                 //not something I'll use a lot, I think. Doesn't need to be very robust!
                 int crewmate = getcrewmanfromname(words[1]);
@@ -971,7 +1292,7 @@ void scriptclass::run(void)
                     obj.entities[i].tile +=12;
                 }
             }
-            else if (words[0] == "changedir")
+            else if (command == Command_changedir)
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -985,16 +1306,16 @@ void scriptclass::run(void)
                     obj.entities[i].dir = 1;
                 }
             }
-            else if (words[0] == "alarmon")
+            else if (command == Command_alarmon)
             {
                 game.alarmon = true;
                 game.alarmdelay = 0;
             }
-            else if (words[0] == "alarmoff")
+            else if (command == Command_alarmoff)
             {
                 game.alarmon = false;
             }
-            else if (words[0] == "changeai")
+            else if (command == Command_changeai)
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -1032,7 +1353,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            else if (words[0] == "activateteleporter")
+            else if (command == Command_activateteleporter)
             {
                 i = obj.getteleporter();
                 if (INBOUNDS_VEC(i, obj.entities))
@@ -1041,7 +1362,7 @@ void scriptclass::run(void)
                     obj.entities[i].colour = 102;
                 }
             }
-            else if (words[0] == "changecolour")
+            else if (command == Command_changecolour)
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -1051,7 +1372,7 @@ void scriptclass::run(void)
                     obj.entities[i].colour = getcolorfromname(words[2]);
                 }
             }
-            else if (words[0] == "squeak")
+            else if (command == Command_squeak)
             {
                 if (words[1] == "player")
                 {
@@ -1090,15 +1411,15 @@ void scriptclass::run(void)
                     music.playef(20);
                 }
             }
-            else if (words[0] == "blackout")
+            else if (command == Command_blackout)
             {
                 game.blackout = true;
             }
-            else if (words[0] == "blackon")
+            else if (command == Command_blackon)
             {
                 game.blackout = false;
             }
-            else if (words[0] == "setcheckpoint")
+            else if (command == Command_setcheckpoint)
             {
                 i = obj.getplayer();
                 game.savepoint = 0;
@@ -1115,16 +1436,16 @@ void scriptclass::run(void)
                     game.savedir = obj.entities[i].dir;
                 }
             }
-            else if (words[0] == "gamestate")
+            else if (command == Command_gamestate)
             {
                 game.state = ss_toi(words[1]);
                 game.statedelay = 0;
             }
-            else if (words[0] == "textboxactive")
+            else if (command == Command_textboxactive)
             {
                 graphics.textboxactive();
             }
-            else if (words[0] == "gamemode")
+            else if (command == Command_gamemode)
             {
                 if (words[1] == "teleporter")
                 {
@@ -1139,7 +1460,7 @@ void scriptclass::run(void)
                     game.prevgamestate = GAMEMODE;
                 }
             }
-            else if (words[0] == "ifexplored")
+            else if (command == Command_ifexplored)
             {
                 if (map.isexplored(ss_toi(words[1]), ss_toi(words[2])))
                 {
@@ -1147,7 +1468,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "iflast")
+            else if (command == Command_iflast)
             {
                 if (game.lastsaved==ss_toi(words[1]))
                 {
@@ -1155,7 +1476,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "ifskip")
+            else if (command == Command_ifskip)
             {
                 if (game.nocutscenes)
                 {
@@ -1163,7 +1484,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "ifflag")
+            else if (command == Command_ifflag)
             {
                 int flag = ss_toi(words[1]);
                 if (INBOUNDS_ARR(flag, obj.flags) && obj.flags[flag])
@@ -1172,7 +1493,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "ifcrewlost")
+            else if (command == Command_ifcrewlost)
             {
                 int crewmate = ss_toi(words[1]);
                 if (INBOUNDS_ARR(crewmate, game.crewstats) && !game.crewstats[crewmate])
@@ -1181,7 +1502,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "iftrinkets")
+            else if (command == Command_iftrinkets)
             {
                 if (game.trinkets() >= ss_toi(words[1]))
                 {
@@ -1189,7 +1510,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "iftrinketsless")
+            else if (command == Command_iftrinketsless)
             {
                 if (game.stat_trinkets < ss_toi(words[1]))
                 {
@@ -1197,23 +1518,23 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "hidecoordinates")
+            else if (command == Command_hidecoordinates)
             {
                 map.setexplored(ss_toi(words[1]), ss_toi(words[2]), false);
             }
-            else if (words[0] == "showcoordinates")
+            else if (command == Command_showcoordinates)
             {
                 map.setexplored(ss_toi(words[1]), ss_toi(words[2]), true);
             }
-            else if (words[0] == "hideship")
+            else if (command == Command_hideship)
             {
                 map.hideship();
             }
-            else if (words[0] == "showship")
+            else if (command == Command_showship)
             {
                 map.showship();
             }
-            else if (words[0] == "showsecretlab")
+            else if (command == Command_showsecretlab)
             {
                 map.setexplored(16, 5, true);
                 map.setexplored(17, 5, true);
@@ -1224,7 +1545,7 @@ void scriptclass::run(void)
                 map.setexplored(19, 7, true);
                 map.setexplored(19, 8, true);
             }
-            else if (words[0] == "hidesecretlab")
+            else if (command == Command_hidesecretlab)
             {
                 map.setexplored(16, 5, false);
                 map.setexplored(17, 5, false);
@@ -1235,31 +1556,31 @@ void scriptclass::run(void)
                 map.setexplored(19, 7, false);
                 map.setexplored(19, 8, false);
             }
-            else if (words[0] == "showteleporters")
+            else if (command == Command_showteleporters)
             {
                 map.showteleporters = true;
             }
-            else if (words[0] == "showtargets")
+            else if (command == Command_showtargets)
             {
                 map.showtargets = true;
             }
-            else if (words[0] == "showtrinkets")
+            else if (command == Command_showtrinkets)
             {
                 map.showtrinkets = true;
             }
-            else if (words[0] == "hideteleporters")
+            else if (command == Command_hideteleporters)
             {
                 map.showteleporters = false;
             }
-            else if (words[0] == "hidetargets")
+            else if (command == Command_hidetargets)
             {
                 map.showtargets = false;
             }
-            else if (words[0] == "hidetrinkets")
+            else if (command == Command_hidetrinkets)
             {
                 map.showtrinkets = false;
             }
-            else if (words[0] == "hideplayer")
+            else if (command == Command_hideplayer)
             {
                 int player = obj.getplayer();
                 if (INBOUNDS_VEC(player, obj.entities))
@@ -1267,7 +1588,7 @@ void scriptclass::run(void)
                     obj.entities[player].invis = true;
                 }
             }
-            else if (words[0] == "showplayer")
+            else if (command == Command_showplayer)
             {
                 int player = obj.getplayer();
                 if (INBOUNDS_VEC(player, obj.entities))
@@ -1275,40 +1596,40 @@ void scriptclass::run(void)
                     obj.entities[player].invis = false;
                 }
             }
-            else if (words[0] == "teleportscript")
+            else if (command == Command_teleportscript)
             {
                 game.teleportscript = words[1];
             }
-            else if (words[0] == "clearteleportscript")
+            else if (command == Command_clearteleportscript)
             {
                 game.teleportscript = "";
             }
-            else if (words[0] == "nocontrol")
+            else if (command == Command_nocontrol)
             {
                 game.hascontrol = false;
             }
-            else if (words[0] == "hascontrol")
+            else if (command == Command_hascontrol)
             {
                 game.hascontrol = true;
             }
-            else if (words[0] == "companion")
+            else if (command == Command_companion)
             {
                 game.companion = ss_toi(words[1]);
             }
-            else if (words[0] == "befadein")
+            else if (command == Command_befadein)
             {
                 graphics.setfade(0);
                 graphics.fademode= 0;
             }
-            else if (words[0] == "fadein")
+            else if (command == Command_fadein)
             {
                 graphics.fademode = 4;
             }
-            else if (words[0] == "fadeout")
+            else if (command == Command_fadeout)
             {
                 graphics.fademode = 2;
             }
-            else if (words[0] == "untilfade")
+            else if (command == Command_untilfade)
             {
                 if (graphics.fademode>1)
                 {
@@ -1316,17 +1637,17 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "entersecretlab")
+            else if (command == Command_entersecretlab)
             {
                 game.unlocknum(8);
                 game.insecretlab = true;
                 SDL_memset(map.explored, true, sizeof(map.explored));
             }
-            else if (words[0] == "leavesecretlab")
+            else if (command == Command_leavesecretlab)
             {
                 game.insecretlab = false;
             }
-            else if (words[0] == "resetgame")
+            else if (command == Command_resetgame)
             {
                 map.resetnames();
                 map.resetmap();
@@ -1365,12 +1686,12 @@ void scriptclass::run(void)
                 map.final_colorframe = 0;
                 map.finalstretch = false;
             }
-            else if (words[0] == "loadscript")
+            else if (command == Command_loadscript)
             {
                 load(raw_words[1]);
                 position--;
             }
-            else if (words[0] == "rollcredits")
+            else if (command == Command_rollcredits)
             {
 #if !defined(NO_CUSTOM_LEVELS) && !defined(NO_EDITOR)
                 if (map.custommode && !map.custommodeforreal)
@@ -1387,12 +1708,12 @@ void scriptclass::run(void)
                     game.creditposition = 0;
                 }
             }
-            else if (words[0] == "finalmode")
+            else if (command == Command_finalmode)
             {
                 map.finalmode = true;
                 map.gotoroom(ss_toi(words[1]), ss_toi(words[2]));
             }
-            else if (words[0] == "rescued")
+            else if (command == Command_rescued)
             {
                 if (words[1] == "red")
                 {
@@ -1423,7 +1744,7 @@ void scriptclass::run(void)
                     game.crewstats[0] = true;
                 }
             }
-            else if (words[0] == "missing")
+            else if (command == Command_missing)
             {
                 if (words[1] == "red")
                 {
@@ -1454,7 +1775,7 @@ void scriptclass::run(void)
                     game.crewstats[0] = false;
                 }
             }
-            else if (words[0] == "face")
+            else if (command == Command_face)
             {
                 int crewmate = getcrewmanfromname(words[1]);
                 if (crewmate != -1) i = crewmate; // Ensure AEM is kept
@@ -1471,7 +1792,7 @@ void scriptclass::run(void)
                     obj.entities[i].dir = 0;
                 }
             }
-            else if (words[0] == "jukebox")
+            else if (command == Command_jukebox)
             {
                 for (j = 0; j < (int) obj.entities.size(); j++)
                 {
@@ -1591,7 +1912,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            else if (words[0] == "createactivityzone")
+            else if (command == Command_createactivityzone)
             {
                 int crew_color = i; // stay consistent with past behavior!
                 if (words[1] == "red")
@@ -1630,24 +1951,25 @@ void scriptclass::run(void)
                     obj.createblock(5, obj.entities[crewman].xp - 32, 0, 96, 240, i, "", (i == 35));
                 }
             }
-            else if (words[0] == "setactivitycolour")
+            else if (command == Command_setactivitycolour)
             {
                 obj.customactivitycolour = words[1];
             }
-            else if (words[0] == "setactivitytext")
+            else if (command == Command_setactivitytext)
             {
                 ++position;
-                if (INBOUNDS_VEC(position, commands))
+                const char* text = getcommand(position);
+                if (text != NULL)
                 {
-                    obj.customactivitytext = commands[position];
+                    obj.customactivitytext = text;
                 }
             }
-            else if (words[0] == "setactivityposition")
+            else if (command == Command_setactivityposition)
             {
                 obj.customactivitypositionx = ss_toi(words[1]);
                 obj.customactivitypositiony = ss_toi(words[2]);
             }
-            else if (words[0] == "createrescuedcrew")
+            else if (command == Command_createrescuedcrew)
             {
                 //special for final level cutscene
                 //starting at 180, create the rescued crewmembers (ingoring violet, who's at 155)
@@ -1673,7 +1995,7 @@ void scriptclass::run(void)
                     i += 25;
                 }
             }
-            else if (words[0] == "restoreplayercolour")
+            else if (command == Command_restoreplayercolour)
             {
                 i = obj.getplayer();
                 if (INBOUNDS_VEC(i, obj.entities))
@@ -1681,7 +2003,7 @@ void scriptclass::run(void)
                     obj.entities[i].colour = 0;
                 }
             }
-            else if (words[0] == "changeplayercolour")
+            else if (command == Command_changeplayercolour)
             {
                 i = obj.getplayer();
 
@@ -1690,15 +2012,15 @@ void scriptclass::run(void)
                     obj.entities[i].colour = getcolorfromname(words[1]);
                 }
             }
-            else if (words[0] == "changerespawncolour")
+            else if (command == Command_changerespawncolour)
             {
                 game.savecolour = getcolorfromname(words[1]);
             }
-            else if (words[0] == "altstates")
+            else if (command == Command_altstates)
             {
                 obj.altstates = ss_toi(words[1]);
             }
-            else if (words[0] == "activeteleporter")
+            else if (command == Command_activeteleporter)
             {
                 i = obj.getteleporter();
                 if (INBOUNDS_VEC(i, obj.entities))
@@ -1706,7 +2028,7 @@ void scriptclass::run(void)
                     obj.entities[i].colour = 101;
                 }
             }
-            else if (words[0] == "foundtrinket")
+            else if (command == Command_foundtrinket)
             {
                 music.silencedasmusik();
                 music.playef(3);
@@ -1748,7 +2070,7 @@ void scriptclass::run(void)
                 }
                 game.backgroundtext = false;
             }
-            else if (words[0] == "foundlab")
+            else if (command == Command_foundlab)
             {
                 music.playef(3);
 
@@ -1770,7 +2092,7 @@ void scriptclass::run(void)
                 }
                 game.backgroundtext = false;
             }
-            else if (words[0] == "foundlab2")
+            else if (command == Command_foundlab2)
             {
                 graphics.textboxremovefast();
 
@@ -1792,7 +2114,7 @@ void scriptclass::run(void)
                 }
                 game.backgroundtext = false;
             }
-            else if (words[0] == "everybodysad")
+            else if (command == Command_everybodysad)
             {
                 for (i = 0; i < (int) obj.entities.size(); i++)
                 {
@@ -1802,7 +2124,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            else if (words[0] == "startintermission2")
+            else if (command == Command_startintermission2)
             {
                 map.finalmode = true; //Enable final level mode
 
@@ -1817,11 +2139,11 @@ void scriptclass::run(void)
 
                 map.gotoroom(46, 54);
             }
-            else if (words[0] == "telesave")
+            else if (command == Command_telesave)
             {
                 if (!game.intimetrial && !game.nodeathmode && !game.inintermission) game.savetele();
             }
-            else if (words[0] == "createlastrescued")
+            else if (command == Command_createlastrescued)
             {
                 r = graphics.crewcolour(game.lastsaved);
                 if (r == 0 || r == PURPLE)
@@ -1836,7 +2158,7 @@ void scriptclass::run(void)
                     obj.entities[i].dir = 1;
                 }
             }
-            else if (words[0] == "specialline")
+            else if (command == Command_specialline)
             {
                 switch(ss_toi(words[1]))
                 {
@@ -1861,7 +2183,7 @@ void scriptclass::run(void)
                     break;
                 }
             }
-            else if (words[0] == "trinketbluecontrol")
+            else if (command == Command_trinketbluecontrol)
             {
                 if (game.trinkets() == 20 && obj.flags[67])
                 {
@@ -1879,7 +2201,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "trinketyellowcontrol")
+            else if (command == Command_trinketyellowcontrol)
             {
                 if (game.trinkets() >= 19)
                 {
@@ -1892,7 +2214,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "redcontrol")
+            else if (command == Command_redcontrol)
             {
                 if (game.insecretlab)
                 {
@@ -1986,7 +2308,7 @@ void scriptclass::run(void)
                 }
             }
             //TODO: Non Urgent fix compiler nesting errors without adding complexity
-            if (words[0] == "greencontrol")
+            if (command == Command_greencontrol)
             {
                 if (game.insecretlab)
                 {
@@ -2053,7 +2375,7 @@ void scriptclass::run(void)
                     position--;
                 }
             }
-            else if (words[0] == "bluecontrol")
+            else if (command == Command_bluecontrol)
             {
                 if (game.insecretlab)
                 {
@@ -2161,7 +2483,7 @@ void scriptclass::run(void)
                     }
                 }
             }
-            else if (words[0] == "yellowcontrol")
+            else if (command == Command_yellowcontrol)
             {
                 if (game.insecretlab)
                 {
@@ -2247,7 +2569,7 @@ void scriptclass::run(void)
                     obj.flags[23] = false;
                 }
             }
-            else if (words[0] == "purplecontrol")
+            else if (command == Command_purplecontrol)
             {
                 //Controls Purple's conversion
                 //Crew rescued:
@@ -3095,7 +3417,7 @@ void scriptclass::hardreset(void)
     const bool version2_2 = GlitchrunnerMode_less_than_or_equal(Glitchrunner2_2);
 
     /* The RNG is 32-bit. We don't _really_ need 64-bit... */
-    xoshiro_seed((Uint32) SDL_GetTicks64());
+    xoshiro_seed(fixedseed ? 0 : (Uint32) SDL_GetTicks64());
 
     //Game:
     game.hascontrol = true;
@@ -3285,6 +3607,8 @@ void scriptclass::hardreset(void)
     //Script Stuff
     position = 0;
     commands.clear();
+    builtinlines = NULL;
+    numbuiltinlines = 0;
     scriptdelay = 0;
     scriptname = "null";
     running = false;
@@ -3308,27 +3632,82 @@ void scriptclass::loadcustom(const std::string& t)
         if(i>=7) cscriptname+=t[i];
     }
 
-    std::string tstring;
-
-    std::vector<std::string>* contents = NULL;
-    for(size_t i = 0; i < customscripts.size(); i++){
-        Script& script_ = customscripts[i];
+    const int index = findcustomscript(cscriptname);
+    if(index == -1){
+        return;
+    }
 
-        if(script_.name == cscriptname){
-            contents = &script_.contents;
-            break;
+    Script& script_ = customscripts[index];
+    const ScriptTranslation& translation = script_.translation;
+    if (!script_.translated)
+    {
+        translatecustom(script_);
+    }
+    else if (translation.tokenized)
+    {
+        /* Leave the words as if the script had just been translated */
+        for (size_t i = 0; i < translation.words.size(); i++)
+        {
+            words[translation.words[i].first] = translation.words[i].second;
+        }
+        for (size_t i = 0; i < translation.raw_words.size(); i++)
+        {
+            raw_words[translation.raw_words[i].first] = translation.raw_words[i].second;
         }
+        SDL_memcpy(argexists, translation.argexists, sizeof(argexists));
+        j = translation.numwords;
+        command = lookupcommand(words[0]);
     }
-    if(contents == NULL){
-        return;
+
+    commands.insert(commands.end(), translation.commands.begin(), translation.commands.end());
+}
+
+/* tokenize() writes every word before the last delimiter, and the one after
+ * it if it isn't blank */
+static void marktokenized(const int numwords, bool wordset[], bool raw_wordset[])
+{
+    for (int k = 0; k < numwords; k++)
+    {
+        wordset[k] = true;
+        raw_wordset[k] = true;
+    }
+    if (numwords < NUM_SCRIPT_ARGS && argexists[numwords])
+    {
+        wordset[numwords] = true;
+        raw_wordset[numwords] = true;
     }
+}
 
-    std::vector<std::string>& lines = *contents;
+void scriptclass::translatecustom(Script& script_)
+{
+    ScriptTranslation& translation = script_.translation;
+    std::vector<std::string>& out = translation.commands;
+    out.clear();
+
+    std::string tstring;
+
+    std::vector<std::string>& lines = script_.contents;
+
+    /* Translating tokenizes every line, and run() can see what that leaves
+     * in words[] after loadcustom() returns, so the cache keeps the slots
+     * that get written. Reading a slot before anything here has written it
+     * picks up whatever ran before; a translation that does that depends on
+     * more than the script, so it isn't cached. */
+    bool wordset[NUM_SCRIPT_ARGS];
+    bool raw_wordset[NUM_SCRIPT_ARGS];
+    SDL_zeroa(wordset);
+    SDL_zeroa(raw_wordset);
+    bool cacheable = true;
 
     //Ok, we've got the relavent script segment, we do a pass to assess it, then run it!
     int customcutscenemode=0;
     for(size_t i=0; i<lines.size(); i++){
-        tokenize(lines[i]);
+        tokenize(lines[i].c_str());
+        marktokenized(j, wordset, raw_wordset);
+        if (!wordset[0])
+        {
+            cacheable = false;
+        }
         if(words[0] == "say"){
             customcutscenemode=1;
         }else if(words[0] == "reply"){
@@ -3337,8 +3716,8 @@ void scriptclass::loadcustom(const std::string& t)
     }
 
     if(customcutscenemode==1){
-        add("cutscene()");
-        add("untilbars()");
+        out.push_back("cutscene()");
+        out.push_back("untilbars()");
     }
     int customtextmode=0;
     int speakermode=0; //0, terminal, numbers for crew
@@ -3347,13 +3726,17 @@ void scriptclass::loadcustom(const std::string& t)
     for(size_t i=0; i<lines.size(); i++){
         words[0]="nothing"; //Default!
         words[1]="1"; //Default!
-        tokenize(lines[i]);
+        wordset[0] = true;
+        wordset[1] = true;
+        tokenize(lines[i].c_str());
+        marktokenized(j, wordset, raw_wordset);
         for (size_t ii = 0; ii < words[0].length(); ii++)
         {
             words[0][ii] = SDL_tolower(words[0][ii]);
         }
+        command = lookupcommand(words[0]);
         if(words[0] == "music"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
             if(words[1]=="0"){
                 tstring="stopmusic()";
             }else{
@@ -3366,127 +3749,127 @@ void scriptclass::loadcustom(const std::string& t)
                 }else if(words[1]=="5"){ tstring="play(6)";
                 }else { tstring="play("+words[1]+")"; }
             }
-            add(tstring);
+            out.push_back(tstring);
         }else if(words[0] == "playremix"){
-            add("play(15)");
+            out.push_back("play(15)");
         }else if(words[0] == "flash"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add("flash(5)");
-            add("shake(20)");
-            add("playef(9)");
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back("flash(5)");
+            out.push_back("shake(20)");
+            out.push_back("playef(9)");
         }else if(words[0] == "sad" || words[0] == "cry"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
             if(words[1]=="player"){
-                add("changemood(player,1)");
+                out.push_back("changemood(player,1)");
             }else if(words[1]=="cyan" || words[1]=="viridian" || words[1]=="1"){
-                add("changecustommood(customcyan,1)");
+                out.push_back("changecustommood(customcyan,1)");
             }else if(words[1]=="purple" || words[1]=="violet" || words[1]=="pink" || words[1]=="2"){
-                add("changecustommood(purple,1)");
+                out.push_back("changecustommood(purple,1)");
             }else if(words[1]=="yellow" || words[1]=="vitellary" || words[1]=="3"){
-                add("changecustommood(yellow,1)");
+                out.push_back("changecustommood(yellow,1)");
             }else if(words[1]=="red" || words[1]=="vermilion" || words[1]=="4"){
-                add("changecustommood(red,1)");
+                out.push_back("changecustommood(red,1)");
             }else if(words[1]=="green" || words[1]=="verdigris" || words[1]=="5"){
-                add("changecustommood(green,1)");
+                out.push_back("changecustommood(green,1)");
             }else if(words[1]=="blue" || words[1]=="victoria" || words[1]=="6"){
-                add("changecustommood(blue,1)");
+                out.push_back("changecustommood(blue,1)");
             }else if(words[1]=="all" || words[1]=="everybody" || words[1]=="everyone"){
-                add("changemood(player,1)");
-                add("changecustommood(customcyan,1)");
-                add("changecustommood(purple,1)");
-                add("changecustommood(yellow,1)");
-                add("changecustommood(red,1)");
-                add("changecustommood(green,1)");
-                add("changecustommood(blue,1)");
+                out.push_back("changemood(player,1)");
+                out.push_back("changecustommood(customcyan,1)");
+                out.push_back("changecustommood(purple,1)");
+                out.push_back("changecustommood(yellow,1)");
+                out.push_back("changecustommood(red,1)");
+                out.push_back("changecustommood(green,1)");
+                out.push_back("changecustommood(blue,1)");
             }else{
-                add("changemood(player,1)");
+                out.push_back("changemood(player,1)");
             }
-            if(squeakmode==0) add("squeak(cry)");
+            if(squeakmode==0) out.push_back("squeak(cry)");
         }else if(words[0] == "happy"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
             if(words[1]=="player"){
-                add("changemood(player,0)");
-                if(squeakmode==0) add("squeak(player)");
+                out.push_back("changemood(player,0)");
+                if(squeakmode==0) out.push_back("squeak(player)");
             }else if(words[1]=="cyan" || words[1]=="viridian" || words[1]=="1"){
-                add("changecustommood(customcyan,0)");
-                if(squeakmode==0) add("squeak(player)");
+                out.push_back("changecustommood(customcyan,0)");
+                if(squeakmode==0) out.push_back("squeak(player)");
             }else if(words[1]=="purple" || words[1]=="violet" || words[1]=="pink" || words[1]=="2"){
-                add("changecustommood(purple,0)");
-                if(squeakmode==0) add("squeak(purple)");
+                out.push_back("changecustommood(purple,0)");
+                if(squeakmode==0) out.push_back("squeak(purple)");
             }else if(words[1]=="yellow" || words[1]=="vitellary" || words[1]=="3"){
-                add("changecustommood(yellow,0)");
-                if(squeakmode==0) add("squeak(yellow)");
+                out.push_back("changecustommood(yellow,0)");
+                if(squeakmode==0) out.push_back("squeak(yellow)");
             }else if(words[1]=="red" || words[1]=="vermilion" || words[1]=="4"){
-                add("changecustommood(red,0)");
-                if(squeakmode==0) add("squeak(red)");
+                out.push_back("changecustommood(red,0)");
+                if(squeakmode==0) out.push_back("squeak(red)");
             }else if(words[1]=="green" || words[1]=="verdigris" || words[1]=="5"){
-                add("changecustommood(green,0)");
-                if(squeakmode==0) add("squeak(green)");
+                out.push_back("changecustommood(green,0)");
+                if(squeakmode==0) out.push_back("squeak(green)");
             }else if(words[1]=="blue" || words[1]=="victoria" || words[1]=="6"){
-                add("changecustommood(blue,0)");
-                if(squeakmode==0) add("squeak(blue)");
+                out.push_back("changecustommood(blue,0)");
+                if(squeakmode==0) out.push_back("squeak(blue)");
             }else if(words[1]=="all" || words[1]=="everybody" || words[1]=="everyone"){
-                add("changemood(player,0)");
-                add("changecustommood(customcyan,0)");
-                add("changecustommood(purple,0)");
-                add("changecustommood(yellow,0)");
-                add("changecustommood(red,0)");
-                add("changecustommood(green,0)");
-                add("changecustommood(blue,0)");
+                out.push_back("changemood(player,0)");
+                out.push_back("changecustommood(customcyan,0)");
+                out.push_back("changecustommood(purple,0)");
+                out.push_back("changecustommood(yellow,0)");
+                out.push_back("changecustommood(red,0)");
+                out.push_back("changecustommood(green,0)");
+                out.push_back("changecustommood(blue,0)");
             }else{
-                add("changemood(player,0)");
-                if(squeakmode==0) add("squeak(player)");
+                out.push_back("changemood(player,0)");
+                if(squeakmode==0) out.push_back("squeak(player)");
             }
         }else if(words[0] == "squeak"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
             if(words[1]=="player"){
-                add("squeak(player)");
+                out.push_back("squeak(player)");
             }else if(words[1]=="cyan" || words[1]=="viridian" || words[1]=="1"){
-                add("squeak(player)");
+                out.push_back("squeak(player)");
             }else if(words[1]=="purple" || words[1]=="violet" || words[1]=="pink" || words[1]=="2"){
-                add("squeak(purple)");
+                out.push_back("squeak(purple)");
             }else if(words[1]=="yellow" || words[1]=="vitellary" || words[1]=="3"){
-                add("squeak(yellow)");
+                out.push_back("squeak(yellow)");
             }else if(words[1]=="red" || words[1]=="vermilion" || words[1]=="4"){
-                add("squeak(red)");
+                out.push_back("squeak(red)");
             }else if(words[1]=="green" || words[1]=="verdigris" || words[1]=="5"){
-                add("squeak(green)");
+                out.push_back("squeak(green)");
             }else if(words[1]=="blue" || words[1]=="victoria" || words[1]=="6"){
-                add("squeak(blue)");
+                out.push_back("squeak(blue)");
             }else if(words[1]=="cry" || words[1]=="sad"){
-                add("squeak(cry)");
+                out.push_back("squeak(cry)");
             }else if(words[1]=="on"){
                 squeakmode=0;
             }else if(words[1]=="off"){
                 squeakmode=1;
             }
         }else if(words[0] == "delay"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add(lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back(lines[i]);
         }else if(words[0] == "flag"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add(lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back(lines[i]);
         }else if(words[0] == "map"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add("custom"+lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back("custom"+lines[i]);
         }else if(words[0] == "warpdir"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add(lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back(lines[i]);
         }else if(words[0] == "ifwarp"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add(lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back(lines[i]);
         }else if(words[0] == "iftrinkets"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add("custom"+lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back("custom"+lines[i]);
         }else if(words[0] == "ifflag"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add("custom"+lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back("custom"+lines[i]);
         }else if(words[0] == "iftrinketsless"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add("custom"+lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back("custom"+lines[i]);
         }else if(words[0] == "destroy"){
-            if(customtextmode==1){ add("endtext"); customtextmode=0;}
-            add(lines[i]);
+            if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
+            out.push_back(lines[i]);
         }else if(words[0] == "speaker"){
             speakermode=0;
             if(words[1]=="gray" || words[1]=="grey" || words[1]=="terminal" || words[1]=="0") speakermode=0;
@@ -3497,6 +3880,10 @@ void scriptclass::loadcustom(const std::string& t)
             if(words[1]=="green" || words[1]=="verdigris" || words[1]=="5") speakermode=5;
             if(words[1]=="blue" || words[1]=="victoria" || words[1]=="6") speakermode=6;
         }else if(words[0] == "say"){
+            if (!wordset[2])
+            {
+                cacheable = false;
+            }
             //Speakers!
             if(words[2]=="terminal" || words[2]=="gray" || words[2]=="grey" || words[2]=="0") speakermode=0;
             if(words[2]=="cyan" || words[2]=="viridian" || words[2]=="player" || words[2]=="1") speakermode=1;
@@ -3507,32 +3894,32 @@ void scriptclass::loadcustom(const std::string& t)
             if(words[2]=="blue" || words[2]=="victoria" || words[2]=="6") speakermode=6;
             switch(speakermode){
                 case 0:
-                    if(squeakmode==0) add("squeak(terminal)");
-                    add("text(gray,0,114,"+words[1]+")");
+                    if(squeakmode==0) out.push_back("squeak(terminal)");
+                    out.push_back("text(gray,0,114,"+words[1]+")");
                 break;
                 case 1: //NOT THE PLAYER
-                    if(squeakmode==0) add("squeak(cyan)");
-                    add("text(cyan,0,0,"+words[1]+")");
+                    if(squeakmode==0) out.push_back("squeak(cyan)");
+                    out.push_back("text(cyan,0,0,"+words[1]+")");
                 break;
                 case 2:
-                    if(squeakmode==0) add("squeak(purple)");
-                    add("text(purple,0,0,"+words[1]+")");
+                    if(squeakmode==0) out.push_back("squeak(purple)");
+                    out.push_back("text(purple,0,0,"+words[1]+")");
                 break;
                 case 3:
-                    if(squeakmode==0) add("squeak(yellow)");
-                    add("text(yellow,0,0,"+words[1]+")");
+                    if(squeakmode==0) out.push_back("squeak(yellow)");
+                    out.push_back("text(yellow,0,0,"+words[1]+")");
                 break;
                 case 4:
-                    if(squeakmode==0) add("squeak(red)");
-                    add("text(red,0,0,"+words[1]+")");
+                    if(squeakmode==0) out.push_back("squeak(red)");
+                    out.push_back("text(red,0,0,"+words[1]+")");
                 break;
                 case 5:
-                    if(squeakmode==0) add("squeak(green)");
-                    add("text(green,0,0,"+words[1]+")");
+                    if(squeakmode==0) out.push_back("squeak(green)");
+                    out.push_back("text(green,0,0,"+words[1]+")");
                 break;
                 case 6:
-                    if(squeakmode==0) add("squeak(blue)");
-                    add("text(blue,0,0,"+words[1]+")");
+                    if(squeakmode==0) out.push_back("squeak(blue)");
+                    out.push_back("text(blue,0,0,"+words[1]+")");
                 break;
             }
             int ti=help.Int(words[1].c_str());
@@ -3540,43 +3927,62 @@ void scriptclass::loadcustom(const std::string& t)
             for(int ti2=0; ti2<nti; ti2++){
                 i++;
                 if(INBOUNDS_VEC(i, lines)){
-                    add(lines[i]);
+                    out.push_back(lines[i]);
                 }
             }
 
             switch(speakermode){
-                case 0: add("customposition(center)"); break;
-                case 1: add("customposition(cyan,above)"); break;
-                case 2: add("customposition(purple,above)"); break;
-                case 3: add("customposition(yellow,above)"); break;
-                case 4: add("customposition(red,above)"); break;
-                case 5: add("customposition(green,above)"); break;
-                case 6: add("customposition(blue,above)"); break;
-            }
-            add("speak_active");
+                case 0: out.push_back("customposition(center)"); break;
+                case 1: out.push_back("customposition(cyan,above)"); break;
+                case 2: out.push_back("customposition(purple,above)"); break;
+                case 3: out.push_back("customposition(yellow,above)"); break;
+                case 4: out.push_back("customposition(red,above)"); break;
+                case 5: out.push_back("customposition(green,above)"); break;
+                case 6: out.push_back("customposition(blue,above)"); break;
+            }
+            out.push_back("speak_active");
             customtextmode=1;
         }else if(words[0] == "reply"){
             //For this version, terminal only
-            if(squeakmode==0) add("squeak(player)");
-            add("text(cyan,0,0,"+words[1]+")");
+            if(squeakmode==0) out.push_back("squeak(player)");
+            out.push_back("text(cyan,0,0,"+words[1]+")");
 
             int ti=help.Int(words[1].c_str());
             int nti = ti>=0 && ti<=50 ? ti : 1;
             for(int ti2=0; ti2<nti; ti2++){
                 i++;
                 if(INBOUNDS_VEC(i, lines)){
-                    add(lines[i]);
+                    out.push_back(lines[i]);
                 }
             }
-            add("position(player,above)");
-            add("speak_active");
+            out.push_back("position(player,above)");
+            out.push_back("speak_active");
             customtextmode=1;
         }
     }
 
-    if(customtextmode==1){ add("endtext"); customtextmode=0;}
+    if(customtextmode==1){ out.push_back("endtext"); customtextmode=0;}
     if(customcutscenemode==1){
-        add("endcutscene()");
-        add("untilbars()");
+        out.push_back("endcutscene()");
+        out.push_back("untilbars()");
     }
+
+    translation.tokenized = !lines.empty();
+    translation.numwords = j;
+    SDL_memcpy(translation.argexists, argexists, sizeof(argexists));
+    translation.words.clear();
+    translation.raw_words.clear();
+    for (int k = 0; k < NUM_SCRIPT_ARGS; k++)
+    {
+        if (wordset[k])
+        {
+            translation.words.push_back(std::make_pair(k, words[k]));
+        }
+        if (raw_wordset[k])
+        {
+            translation.raw_words.push_back(std::make_pair(k, raw_words[k]));
+        }
+    }
+
+    script_.translated = cacheable;
 }
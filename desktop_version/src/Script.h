@@ -2,20 +2,56 @@
 #define SCRIPT_H
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <SDL.h>
 
-#define filllines(lines) commands.insert(commands.end(), lines, lines + SDL_arraysize(lines))
+/* A script that ships with the game. Its lines are static, so loading it
+ * points at them instead of copying them into commands. */
+struct BuiltinScript
+{
+    const char* name;
+    const char* const* lines;
+    size_t numlines;
+};
+
+#define BUILTIN_SCRIPT(name) {#name, name, SDL_arraysize(name)}
+
+#ifdef SELFTEST
+/* Every script that ships with the game, for -selftest and -benchmark.
+ * Points table at them and returns how many there are. */
+size_t SCRIPT_getbuiltins(const BuiltinScript** table);
+size_t SCRIPT_getterminals(const BuiltinScript** table);
+#endif
 
+#define NUM_SCRIPT_ARGS 40
+
+/* What loadcustom() turns a custom script into */
+struct ScriptTranslation
+{
+    std::vector<std::string> commands;
+
+    /* The tokenizer state translating left behind: the word slots it wrote,
+     * and argexists and the word count from its last line */
+    bool tokenized;
+    int numwords;
+    std::vector<std::pair<int, std::string> > words, raw_words;
+    bool argexists[NUM_SCRIPT_ARGS];
+};
 
 struct Script
 {
     std::string name;
     std::vector<std::string> contents;
-};
 
-#define NUM_SCRIPT_ARGS 40
+    /* translation is worked out the first time the script is loaded. To
+     * change contents, replace the whole Script, as the editor does. */
+    bool translated;
+    ScriptTranslation translation;
+
+    Script(void) : translated(false) {}
+};
 
 class scriptclass
 {
@@ -35,7 +71,26 @@ public:
 
     void clearcustom(void);
 
-    void tokenize(const std::string& t);
+    void addcustomscript(const Script& script_);
+
+    void removecustomscript(const std::string& name);
+
+    int findcustomscript(const std::string& name);
+
+    /* Read-only, so customscript_index can't go stale. Scripts are changed
+     * through addcustomscript() and removecustomscript(). */
+    const std::vector<Script>& getcustomscripts(void)
+    {
+        return customscripts;
+    }
+
+    void tokenize(const char* t);
+
+#ifdef SELFTEST
+    /* The rest of what tokenize() leaves behind, for -selftest */
+    const std::string& getrawword(int index);
+    bool getargexists(int index);
+#endif
 
     void run(void);
 
@@ -49,6 +104,9 @@ public:
 
     //Script contents
     std::vector<std::string> commands;
+    /* If a built-in script is loaded, its lines are run instead of commands */
+    const char* const* builtinlines;
+    size_t numbuiltinlines;
     std::string words[NUM_SCRIPT_ARGS];
     std::vector<std::string> txt;
     std::string scriptname;
@@ -58,6 +116,10 @@ public:
     int scriptdelay;
     bool running;
 
+    /* Seed the RNG with 0 instead of the time in hardreset(), so headless
+     * runs of the same replay hash the same */
+    bool fixedseed;
+
     //Textbox stuff
     int textx;
     int texty;
@@ -67,8 +129,22 @@ public:
     //Misc
     int i, j, k;
 
+private:
     //Custom level stuff
     std::vector<Script> customscripts;
+
+    bool loadbuiltin(const BuiltinScript* table, size_t size, const char* name);
+
+    const char* getcommand(int index);
+
+    void translatecustom(Script& script_);
+
+    void reindexcustomscripts(void);
+
+    /* Open-addressed hash from script name to its index in customscripts,
+     * at most half full. Only the first script with a given name is in it,
+     * since that's the one that's always been run. Empty slots are -1. */
+    std::vector<int> customscript_index;
 };
 
 #ifndef SCRIPT_DEFINITION
@@ -0,0 +1,1362 @@
+#include "SelfTest.h"
+
+#include <map>
+#include <SDL.h>
+#include <utf8/unchecked.h>
+#include <vector>
+
+#include "Constants.h"
+#include "Entity.h"
+#include "FileSystemUtils.h"
+#include "Graphics.h"
+#include "GraphicsUtil.h"
+#include "Map.h"
+#include "Script.h"
+#include "Vlogging.h"
+
+/* Both of these need the resources loaded and the buffers created, so
+ * main() runs them in place of the game loop. */
+
+static double seconds_since(const Uint64 start)
+{
+    return (double) (SDL_GetPerformanceCounter() - start)
+        / SDL_GetPerformanceFrequency();
+}
+
+/* Where benchmarks put results, so they aren't optimised away */
+static volatile Uint32 sink;
+
+/* Calls func(0), func(1)... until at least a quarter of a second has gone
+ * by, and returns the average time per call. */
+static double time_per_call(void (*func)(int))
+{
+    Uint64 start;
+    double seconds;
+    int calls = 0;
+
+    func(-1); /* warm up */
+    start = SDL_GetPerformanceCounter();
+
+    do
+    {
+        func(calls);
+        calls++;
+        seconds = seconds_since(start);
+    }
+    while (seconds < 0.25);
+
+    return seconds / calls;
+}
+
+static Uint32 xorshift(Uint32* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/* Same noise every time, so two draws start from the same destination */
+static void fill_noise(SDL_Surface* surface)
+{
+    Uint32 state = 0x2545F491;
+
+    for (int y = 0; y < surface->h; y++)
+    {
+        Uint32* row = (Uint32*) ((Uint8*) surface->pixels + y * surface->pitch);
+
+        for (int x = 0; x < surface->w; x++)
+        {
+            row[x] = xorshift(&state);
+        }
+    }
+}
+
+/* A surface like the back buffer, for comparing with */
+static SDL_Surface* make_buffer(const int w, const int h)
+{
+    const SDL_PixelFormat* fmt = graphics.backBuffer->format;
+    SDL_Surface* surface = SDL_CreateRGBSurface(
+        0, w, h, fmt->BitsPerPixel, fmt->Rmask, fmt->Gmask, fmt->Bmask, fmt->Amask
+    );
+
+    if (surface != NULL)
+    {
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+    }
+    return surface;
+}
+
+/* Row y of a, against row (y + origin) % h of b */
+static bool same_rows(SDL_Surface* a, SDL_Surface* b, const int origin)
+{
+    for (int y = 0; y < a->h; y++)
+    {
+        const Uint8* row_a = (const Uint8*) a->pixels + y * a->pitch;
+        const Uint8* row_b = (const Uint8*) b->pixels + ((y + origin) % b->h) * b->pitch;
+
+        if (SDL_memcmp(row_a, row_b, a->w * a->format->BytesPerPixel) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static const Uint32 test_colours[] = {
+    0xFFFFFFFF,
+    0xFFA4A4FF,
+    0xC0FF3C1E,
+    0x7F10E080,
+    0x01FFFFFF
+};
+
+/* Every tile of each of these gets drawn by -selftest */
+struct TestSheet
+{
+    const char* name;
+    TileSheet* sheet;
+};
+
+static const TestSheet test_sheets[] = {
+    {"tiles", &graphics.tiles},
+    {"tiles2", &graphics.tiles2},
+    {"tiles3", &graphics.tiles3},
+    {"entcolours", &graphics.entcolours},
+    {"sprites", &graphics.sprites},
+    {"flipsprites", &graphics.flipsprites}
+};
+
+static TileSheet* drawn_sheet = NULL;
+
+/* Where tile t goes in colour c on pass i; moves around so that some
+ * tiles hang off the edges of the back buffer */
+static SDL_Rect test_position(const size_t t, const size_t c, const int i)
+{
+    const int offset = i < 0 ? 0 : i;
+    SDL_Rect rect = {
+        (int) ((t * 37 + c * 11 + offset) % 352) - 16,
+        (int) ((t * 13 + c * 29 + offset) % 272) - 16,
+        0,
+        0
+    };
+    return rect;
+}
+
+/* Every tile of drawn_sheet in every test colour */
+static void draw_coloured(const int i)
+{
+    for (size_t c = 0; c < SDL_arraysize(test_colours); c++)
+    {
+        colourTransform ct;
+        ct.colour = test_colours[c];
+
+        for (size_t t = 0; t < drawn_sheet->size(); t++)
+        {
+            SDL_Rect rect = test_position(t, c, i);
+            BlitSurfaceColoured(
+                drawn_sheet->surface,
+                &drawn_sheet->rects[t],
+                graphics.backBuffer,
+                &rect,
+                ct
+            );
+        }
+    }
+}
+
+static void draw_tinted(const int i)
+{
+    for (size_t c = 0; c < SDL_arraysize(test_colours); c++)
+    {
+        colourTransform ct;
+        ct.colour = test_colours[c];
+
+        for (size_t t = 0; t < drawn_sheet->size(); t++)
+        {
+            SDL_Rect rect = test_position(t, c, i);
+            BlitSurfaceTinted(
+                drawn_sheet->surface,
+                &drawn_sheet->rects[t],
+                graphics.backBuffer,
+                &rect,
+                ct
+            );
+        }
+    }
+}
+
+/* Every glyph of the font the way PrintAlpha() draws them, at both scales
+ * the game uses and flipped or not */
+static void draw_glyphs(const int i)
+{
+    const TileSheet& font = graphics.bfont;
+    SDL_Point positions[64];
+
+    for (int scale = 1; scale <= 2; scale++)
+    {
+        for (int flip = 0; flip < 2; flip++)
+        {
+            for (size_t c = 0; c < SDL_arraysize(test_colours); c++)
+            {
+                colourTransform ct;
+                ct.colour = test_colours[c];
+
+                for (size_t first = 0; first < font.size(); first += SDL_arraysize(positions))
+                {
+                    const size_t count = SDL_min(SDL_arraysize(positions), font.size() - first);
+
+                    for (size_t g = 0; g < count; g++)
+                    {
+                        const SDL_Rect rect = test_position(first + g, c + scale * 2 + flip, i);
+                        positions[g].x = rect.x;
+                        positions[g].y = rect.y;
+                    }
+
+                    BlitTilesColoured(
+                        font.surface,
+                        &font.rects[first],
+                        positions,
+                        count,
+                        scale,
+                        flip,
+                        graphics.backBuffer,
+                        ct
+                    );
+                }
+            }
+        }
+    }
+}
+
+/* The warp zone background's scrolling, plus some it never does */
+static void scroll_buffer(int)
+{
+    static const SDL_Point offsets[] = {
+        {-3, 0}, {0, -3}, {3, 0}, {0, 3}, {-2, 5}, {7, -1}, {0, 0}
+    };
+
+    SDL_Surface* buffer = graphics.backBuffer;
+
+    for (size_t o = 0; o < SDL_arraysize(offsets); o++)
+    {
+        ScrollSurface(buffer, offsets[o].x, offsets[o].y);
+    }
+}
+
+static size_t sheet_blits(void)
+{
+    return drawn_sheet->size() * SDL_arraysize(test_colours);
+}
+
+static size_t glyph_blits(void)
+{
+    /* Two scales, flipped and not */
+    return graphics.bfont.size() * SDL_arraysize(test_colours) * 4;
+}
+
+static const char* const kernelnames[] = {
+    "auto",
+    "SDL",
+    "scalar",
+    "SIMD"
+};
+
+/* Draws with kernels a and b onto the same noise and compares every pixel */
+static bool draws_same(
+    const char* name,
+    void (*draw)(int),
+    const enum BlitKernels a,
+    const enum BlitKernels b
+) {
+    SDL_Surface* buffer = graphics.backBuffer;
+    SDL_Surface* expected;
+    bool same = true;
+
+    fill_noise(buffer);
+    SetBlitKernels(a);
+    draw(0);
+    expected = SDL_ConvertSurface(buffer, buffer->format, 0);
+
+    fill_noise(buffer);
+    SetBlitKernels(b);
+    draw(0);
+    SetBlitKernels(BlitKernels_Auto);
+
+    if (expected == NULL)
+    {
+        vlog_error("%s: couldn't copy the back buffer", name);
+        return false;
+    }
+
+    for (int y = 0; y < buffer->h && same; y++)
+    {
+        const Uint32* row_a = (const Uint32*) ((const Uint8*) expected->pixels + y * expected->pitch);
+        const Uint32* row_b = (const Uint32*) ((const Uint8*) buffer->pixels + y * buffer->pitch);
+
+        for (int x = 0; x < buffer->w; x++)
+        {
+            if (row_a[x] != row_b[x])
+            {
+                vlog_error(
+                    "FAIL %s: %s drew %08X at %i,%i, %s drew %08X",
+                    name, kernelnames[a], row_a[x], x, y, kernelnames[b], row_b[x]
+                );
+                same = false;
+                break;
+            }
+        }
+    }
+
+    SDL_FreeSurface(expected);
+
+    if (same)
+    {
+        vlog_info("ok   %s: %s and %s", name, kernelnames[a], kernelnames[b]);
+    }
+    return same;
+}
+
+/* Hitest() with the masks against a table built straight from the red
+ * pixels: sprite 2 at offset d from sprite 1 hits if any red pixel a of
+ * sprite 1 and b of sprite 2 have a = b + d. Every pair of frames, at
+ * every offset where they overlap and one past it on every side. The
+ * per-pixel fallback is slow, so it's checked on two pairs per frame. */
+static int test_hitest(const char* name, TileSheet& sheet)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const int w = sheet.rects.empty() ? 0 : sheet.rects[0].w;
+    const int h = sheet.rects.empty() ? 0 : sheet.rects[0].h;
+    const int span_x = 2 * w + 1;
+    const int span_y = 2 * h + 1;
+    std::vector<std::vector<SDL_Point> > red(sheet.size());
+    std::vector<bool> hits(span_x * span_y);
+    TileSheet unmasked = sheet;
+    const point p1 = {0, 0};
+    size_t tests = 0;
+    size_t fallback_tests = 0;
+
+    if (sheet.masks.empty())
+    {
+        vlog_error("FAIL Hitest() on %s: no masks", name);
+        return 1;
+    }
+    unmasked.masks.clear();
+
+    for (size_t f = 0; f < sheet.size(); f++)
+    {
+        for (int y = 0; y < h; y++)
+        {
+            for (int x = 0; x < w; x++)
+            {
+                const Uint32 pixel = ReadPixel(sheet.surface, sheet.rects[f].x + x, sheet.rects[f].y + y);
+                if (pixel & sheet.surface->format->Rmask)
+                {
+                    const SDL_Point a = {x, y};
+                    red[f].push_back(a);
+                }
+            }
+        }
+    }
+
+    for (size_t f1 = 0; f1 < sheet.size(); f1++)
+    {
+        for (size_t f2 = 0; f2 < sheet.size(); f2++)
+        {
+            const bool fallback = f2 == f1 || f2 == (f1 * 7 + 3) % sheet.size();
+
+            hits.assign(hits.size(), false);
+            for (size_t i = 0; i < red[f1].size(); i++)
+            {
+                for (size_t j = 0; j < red[f2].size(); j++)
+                {
+                    const int dx = red[f1][i].x - red[f2][j].x;
+                    const int dy = red[f1][i].y - red[f2][j].y;
+                    hits[(dx + w) + (dy + h) * span_x] = true;
+                }
+            }
+
+            for (int dy = -h; dy <= h; dy++)
+            {
+                for (int dx = -w; dx <= w; dx++)
+                {
+                    const point p2 = {dx, dy};
+                    const bool expected = hits[(dx + w) + (dy + h) * span_x];
+
+                    if (graphics.Hitest(sheet, f1, p1, f2, p2) != expected
+                    || (fallback && graphics.Hitest(unmasked, f1, p1, f2, p2) != expected))
+                    {
+                        vlog_error(
+                            "FAIL Hitest() on %s: frames %i and %i at %i,%i should be %s",
+                            name, (int) f1, (int) f2, dx, dy, expected ? "a hit" : "a miss"
+                        );
+                        return 1;
+                    }
+                }
+            }
+
+            tests += span_x * span_y;
+            fallback_tests += fallback ? span_x * span_y : 0;
+        }
+    }
+
+    vlog_info(
+        "ok   Hitest() on %s: %i tests, %i of them also per pixel, %.1f s",
+        name, (int) tests, (int) fallback_tests, seconds_since(start)
+    );
+    return 0;
+}
+
+/* mapclass::collide() before the solidity grid */
+static bool oldcollide(const int x, const int y)
+{
+    if (map.towermode)
+    {
+        if (map.tower.at(x, y, 0) >= 12 && map.tower.at(x, y, 0) <= 27) return true;
+        if (map.invincibility)
+        {
+            if (map.tower.at(x, y, 0) >= 6 && map.tower.at(x, y, 0) <= 11) return true;
+        }
+    }
+    else if (map.tileset == 2)
+    {
+        int tile;
+        if (y == -1) return oldcollide(x, y + 1);
+        if (y == 29+map.extrarow) return oldcollide(x, y - 1);
+        if (x == -1) return oldcollide(x + 1, y);
+        if (x == 40) return oldcollide(x - 1, y);
+        if (x < 0 || y < 0 || x >= 40 || y >= 29 + map.extrarow) return false;
+        tile = map.contents[TILE_IDX(x, y)];
+        if (tile >= 12 && tile <= 27) return true;
+        if (map.invincibility)
+        {
+            if (tile >= 6 && tile <= 11) return true;
+        }
+    }
+    else
+    {
+        int tile;
+        if (y == -1) return oldcollide(x, y + 1);
+        if (y == 29+map.extrarow) return oldcollide(x, y - 1);
+        if (x == -1) return oldcollide(x + 1, y);
+        if (x == 40) return oldcollide(x - 1, y);
+        if (x < 0 || y < 0 || x >= 40 || y >= 29+map.extrarow) return false;
+        tile = map.contents[TILE_IDX(x, y)];
+        if (tile == 1) return true;
+        if (map.tileset==0 && tile == 59) return true;
+        if (tile>= 80 && tile < 680) return true;
+        if (tile == 740 && map.tileset==1) return true;
+        if (map.invincibility)
+        {
+            if (tile>= 6 && tile <= 9) return true;
+            if (tile>= 49 && tile <= 50) return true;
+            if (map.tileset == 1)
+            {
+                if (tile>= 49 && tile < 80) return true;
+            }
+        }
+    }
+    return false;
+}
+
+/* Every cell from two outside the room to two past it, with and without
+ * invincibility, and spikecollide() too in the towers */
+static bool collide_matches(const char* name, const int height)
+{
+    for (int invincible = 0; invincible < 2; invincible++)
+    {
+        map.invincibility = invincible;
+
+        for (int y = -2; y < height + 2; y++)
+        {
+            for (int x = -2; x < 42; x++)
+            {
+                const bool spikes = map.towermode && !map.invincibility
+                    && map.tower.at(x, y, 0) >= 6 && map.tower.at(x, y, 0) <= 11;
+
+                if (map.collide(x, y) != oldcollide(x, y)
+                || (map.towermode && map.spikecollide(x, y) != spikes))
+                {
+                    vlog_error(
+                        "FAIL collide() in %s at %i,%i, invincibility %i",
+                        name, x, y, invincible
+                    );
+                    map.invincibility = false;
+                    return false;
+                }
+            }
+        }
+    }
+
+    map.invincibility = false;
+    return true;
+}
+
+/* A room of random tiles; small ones are common, so spikes and the
+ * special cases come up often */
+static void random_room(Uint32* state)
+{
+    for (int i = 0; i < 40 * 30; i++)
+    {
+        const Uint32 r = xorshift(state);
+        map.contents[i] = r % 4 == 0 ? (r >> 8) % 800 : (r >> 8) % 100;
+    }
+    map.makecollision();
+}
+
+/* Random rooms in every tileset, with and without the extra row, then
+ * changed a tile at a time with settile(); then both towers */
+static int test_collide(void)
+{
+    Uint32 state = 0x85EBCA6B;
+    char name[64];
+    int rooms = 0;
+
+    map.towermode = false;
+
+    for (int tileset = 0; tileset < 3; tileset++)
+    {
+        for (int extrarow = 0; extrarow < 2; extrarow++)
+        {
+            for (int room = 0; room < 20; room++)
+            {
+                map.tileset = tileset;
+                map.extrarow = extrarow;
+                random_room(&state);
+                SDL_snprintf(name, sizeof(name), "tileset %i, extrarow %i", tileset, extrarow);
+
+                for (int i = 0; i < 50; i++)
+                {
+                    const Uint32 r = xorshift(&state);
+                    if (!collide_matches(name, 30))
+                    {
+                        return 1;
+                    }
+                    map.settile(r % 40, (r >> 8) % 30, (r >> 16) % 800);
+                }
+                rooms++;
+            }
+        }
+    }
+
+    map.towermode = true;
+    map.tower.minitowermode = false;
+    if (!collide_matches("the tower", 700))
+    {
+        return 1;
+    }
+    map.tower.minitowermode = true;
+    map.tower.loadminitower1();
+    if (!collide_matches("minitower 1", 100))
+    {
+        return 1;
+    }
+    map.tower.loadminitower2();
+    if (!collide_matches("minitower 2", 100))
+    {
+        return 1;
+    }
+    map.tower.minitowermode = false;
+    map.towermode = false;
+
+    vlog_info("ok   collide() in %i rooms and the towers", rooms);
+    return 0;
+}
+
+static void collide_room(int)
+{
+    for (int y = -1; y <= 30; y++)
+    {
+        for (int x = -1; x <= 40; x++)
+        {
+            sink += map.collide(x, y);
+        }
+    }
+}
+
+static void oldcollide_room(int)
+{
+    for (int y = -1; y <= 30; y++)
+    {
+        for (int x = -1; x <= 40; x++)
+        {
+            sink += oldcollide(x, y);
+        }
+    }
+}
+
+/* The per-entity passes of gamelogic() that entclass's field order is
+ * for: saving the lerp positions, then updateentitylogic() and
+ * entitymapcollision() */
+static void step_entities(int)
+{
+    for (size_t i = 0; i < obj.entities.size(); i++)
+    {
+        obj.entities[i].lerpoldxp = obj.entities[i].xp;
+        obj.entities[i].lerpoldyp = obj.entities[i].yp;
+    }
+
+    for (size_t i = 0; i < obj.entities.size(); i++)
+    {
+        obj.updateentitylogic(i);
+        obj.entitymapcollision(i);
+    }
+}
+
+/* count entities moving and falling around a room with solid edges. This
+ * only times whatever layout entclass has; there's no copy of the old one
+ * to compare against, so build a tree without the reorder for that. */
+static void benchmark_entities(const int count)
+{
+    std::vector<entclass> saved;
+
+    saved.swap(obj.entities);
+
+    for (int i = 0; i < count; i++)
+    {
+        entclass entity;
+        entity.rule = i % 3;
+        entity.type = 0;
+        entity.xp = 16 + (i * 37) % 272;
+        entity.yp = 16 + (i * 13) % 192;
+        entity.w = 16;
+        entity.h = 16;
+        entity.vx = (float) (i % 7 - 3);
+        entity.gravity = i % 2 == 0;
+        obj.entities.push_back(entity);
+    }
+
+    vlog_info(
+        "Entity physics, %i entities: %.1f ns per entity",
+        count,
+        time_per_call(step_entities) * 1e9 / count
+    );
+
+    obj.entities.swap(saved);
+}
+
+/* The tower background as it was: a flat buffer that gets ScrollSurface()d,
+ * and a scratch copy of it scrolled again to present it */
+static SDL_Surface* tower_flat = NULL;
+static SDL_Surface* tower_scratch = NULL;
+static SDL_Surface* tower_ring = NULL;
+static int tower_origin = 0;
+static SDL_Surface* tower_dest = NULL;
+
+static bool make_tower_buffers(void)
+{
+    tower_flat = make_buffer(320 + 16, 240 + 16);
+    tower_scratch = make_buffer(320 + 16, 240 + 16);
+    tower_ring = make_buffer(320 + 16, 240 + 16);
+    tower_dest = make_buffer(320, 240);
+    tower_origin = 0;
+
+    if (tower_flat == NULL || tower_scratch == NULL
+    || tower_ring == NULL || tower_dest == NULL)
+    {
+        vlog_error("Couldn't create the tower buffers");
+        return false;
+    }
+
+    fill_noise(tower_flat);
+    fill_noise(tower_ring);
+    return true;
+}
+
+static void free_tower_buffers(void)
+{
+    SDL_FreeSurface(tower_flat);
+    SDL_FreeSurface(tower_scratch);
+    SDL_FreeSurface(tower_ring);
+    SDL_FreeSurface(tower_dest);
+    tower_flat = NULL;
+    tower_scratch = NULL;
+    tower_ring = NULL;
+    tower_dest = NULL;
+}
+
+/* drawtowerbackground() before the ring buffers */
+static void present_flat(const int scroll)
+{
+    ClearSurface(tower_dest);
+    SDL_BlitSurface(tower_flat, NULL, tower_scratch, NULL);
+    ScrollSurface(tower_scratch, 0, scroll);
+    SDL_BlitSurface(tower_scratch, &graphics.towerbuffer_rect, tower_dest, NULL);
+}
+
+static void present_ring(const int scroll)
+{
+    ClearSurface(tower_dest);
+    BlitScrolledRing(tower_ring, tower_origin, scroll, &graphics.towerbuffer_rect, tower_dest);
+}
+
+/* Random scrolls, tiles3 blits and presents, done to a flat buffer the
+ * old way and to a ring buffer, checking the logical rows after every
+ * step and the presented frame after every present */
+static int test_tower_ring(void)
+{
+    SDL_Surface* expected = NULL;
+    Uint32 state = 0x9E3779B9;
+    int failures = 0;
+
+    if (!make_tower_buffers() || (expected = make_buffer(320, 240)) == NULL)
+    {
+        free_tower_buffers();
+        return 1;
+    }
+
+    for (int step = 0; step < 4000 && failures == 0; step++)
+    {
+        const Uint32 r = xorshift(&state);
+        const int scroll = (int) (r >> 8) % 25 - 12;
+
+        switch (r % 3)
+        {
+        case 0:
+            ScrollSurface(tower_flat, 0, scroll);
+            ScrollRingSurface(tower_ring, &tower_origin, scroll);
+            break;
+        case 1:
+        {
+            const size_t t = (r >> 16) % graphics.tiles3.size();
+            SDL_Rect flatrect = {(int) (r >> 4) % 352 - 8, (int) (r >> 12) % 272 - 8, 8, 8};
+            const SDL_Rect ringrect = flatrect;
+            BlitSurfaceStandard(graphics.tiles3.surface, &graphics.tiles3.rects[t], tower_flat, &flatrect);
+            BlitSurfaceToRing(graphics.tiles3.surface, &graphics.tiles3.rects[t], tower_ring, tower_origin, &ringrect);
+            break;
+        }
+        case 2:
+            present_flat(scroll);
+            SDL_BlitSurface(tower_dest, NULL, expected, NULL);
+            present_ring(scroll);
+            if (!same_rows(expected, tower_dest, 0))
+            {
+                vlog_error("FAIL tower ring buffer: frame presented at step %i differs", step);
+                failures++;
+            }
+            break;
+        }
+
+        if (failures == 0 && !same_rows(tower_flat, tower_ring, tower_origin))
+        {
+            vlog_error("FAIL tower ring buffer: contents differ after step %i", step);
+            failures++;
+        }
+    }
+
+    if (failures == 0)
+    {
+        vlog_info("ok   tower ring buffer");
+    }
+
+    SDL_FreeSurface(expected);
+    free_tower_buffers();
+    return failures;
+}
+
+static void scroll_tower_flat(const int i)
+{
+    ScrollSurface(tower_flat, 0, i % 2 == 0 ? -2 : 2);
+}
+
+static void scroll_tower_ring(const int i)
+{
+    ScrollRingSurface(tower_ring, &tower_origin, i % 2 == 0 ? -2 : 2);
+}
+
+static void present_tower_flat(int)
+{
+    present_flat(-1);
+}
+
+static void present_tower_ring(int)
+{
+    present_ring(-1);
+}
+
+/* font.txt read into the std::map from codepoint to glyph that the font
+ * used to be looked up in */
+static std::map<int, int> font_positions;
+static std::vector<uint32_t> font_codepoints;
+
+static void load_font_positions(void)
+{
+    unsigned char* charmap;
+    size_t length;
+
+    font_positions.clear();
+    font_codepoints.clear();
+
+    FILESYSTEM_loadAssetToMemory("graphics/font.txt", &charmap, &length, false);
+    if (charmap != NULL)
+    {
+        unsigned char* current = charmap;
+        unsigned char* end = charmap + length;
+        int pos = 0;
+
+        while (current != end)
+        {
+            const int codepoint = utf8::unchecked::next(current);
+            font_positions[codepoint] = pos;
+            font_codepoints.push_back(codepoint);
+            ++pos;
+        }
+        FILESYSTEM_freeMemory(&charmap);
+    }
+}
+
+/* Graphics::font_idx() as it was */
+static int old_font_idx(const uint32_t ch)
+{
+    if (font_positions.size() > 0)
+    {
+        std::map<int, int>::iterator iter = font_positions.find(ch);
+        if (iter == font_positions.end())
+        {
+            iter = font_positions.find('?');
+            if (iter == font_positions.end())
+            {
+                return -1;
+            }
+        }
+        return iter->second;
+    }
+    return ch;
+}
+
+/* Every codepoint Unicode has, not just the ones in font.txt */
+static int test_font_idx(void)
+{
+    load_font_positions();
+
+    for (uint32_t ch = 0; ch <= 0x10FFFF; ch++)
+    {
+        const int expected = old_font_idx(ch);
+        const int idx = graphics.font_idx(ch);
+
+        if (idx != expected)
+        {
+            vlog_error("FAIL font_idx(U+%04X) is %i, the std::map had %i", ch, idx, expected);
+            return 1;
+        }
+    }
+
+    vlog_info("ok   font_idx() over %i mapped codepoints", (int) font_positions.size());
+    return 0;
+}
+
+static void lookup_font_idx(int)
+{
+    for (size_t i = 0; i < font_codepoints.size(); i++)
+    {
+        sink += graphics.font_idx(font_codepoints[i]);
+    }
+}
+
+static void lookup_old_font_idx(int)
+{
+    for (size_t i = 0; i < font_codepoints.size(); i++)
+    {
+        sink += old_font_idx(font_codepoints[i]);
+    }
+}
+
+/* PrintWrap()'s line breaking as it was before the layouts were cached */
+static void old_wraplayout(
+    const char* str,
+    const int maxwidth,
+    std::vector<Graphics::WrapLine>* lines
+) {
+    char buffer[54*4 + 1];
+    size_t start = 0;
+
+    lines->clear();
+    while (graphics.next_wrap_s(buffer, sizeof(buffer), &start, str, maxwidth))
+    {
+        Graphics::WrapLine line;
+        line.text = buffer;
+        line.width = graphics.len(line.text);
+        lines->push_back(line);
+    }
+}
+
+static const char* const wrap_texts[] = {
+    "To install new player levels, copy the .vvvvvv files to the levels folder.",
+    "Are you sure you want to show the levels path? This may reveal sensitive information if you are streaming.",
+    "(Note: The game is autosaved at every teleporter.)",
+    "Line one\nLine two\n\nLine four",
+    "Supercalifragilisticexpialidocious-and-no-spaces-so-it-never-breaks",
+    "Caf\xC3\xA9 \xE2\x80\x94 na\xC3\xAFve",
+    "",
+    /* These two have the same FNV-1a hash */
+    "costarring",
+    "liquid"
+};
+
+/* Every text at every width from 8 to 320, twice in a row so the second
+ * one is a hit, in three passes so the cache keeps evicting. Below 8 a
+ * line can't fit a single character and next_wrap() never finishes. */
+static int test_wraplayout(void)
+{
+    std::vector<Graphics::WrapLine> expected;
+    int layouts = 0;
+
+    for (int pass = 0; pass < 3; pass++)
+    {
+        for (int maxwidth = 8; maxwidth <= 320; maxwidth += 8)
+        {
+            for (size_t i = 0; i < SDL_arraysize(wrap_texts); i++)
+            {
+                old_wraplayout(wrap_texts[i], maxwidth, &expected);
+
+                for (int repeat = 0; repeat < 2; repeat++)
+                {
+                    const std::vector<Graphics::WrapLine>& lines =
+                        graphics.wraplayout(wrap_texts[i], maxwidth);
+                    bool same = lines.size() == expected.size();
+
+                    for (size_t l = 0; same && l < lines.size(); l++)
+                    {
+                        same = lines[l].text == expected[l].text
+                            && lines[l].width == expected[l].width;
+                    }
+
+                    if (!same)
+                    {
+                        vlog_error(
+                            "FAIL wraplayout(\"%s\", %i) differs on pass %i",
+                            wrap_texts[i], maxwidth, pass
+                        );
+                        return 1;
+                    }
+                    layouts++;
+                }
+            }
+        }
+    }
+
+    vlog_info("ok   wraplayout() over %i layouts", layouts);
+    return 0;
+}
+
+static void wrap_cached(int)
+{
+    for (size_t i = 0; i < SDL_arraysize(wrap_texts); i++)
+    {
+        sink += graphics.wraplayout(wrap_texts[i], 304).size();
+    }
+}
+
+static void wrap_uncached(int)
+{
+    std::vector<Graphics::WrapLine> lines;
+
+    for (size_t i = 0; i < SDL_arraysize(wrap_texts); i++)
+    {
+        old_wraplayout(wrap_texts[i], 304, &lines);
+        sink += lines.size();
+    }
+}
+
+/* tokenize() as it was, before it copied spans of the line */
+static std::string old_words[NUM_SCRIPT_ARGS];
+static std::string old_raw_words[NUM_SCRIPT_ARGS];
+static bool old_argexists[NUM_SCRIPT_ARGS];
+static int old_j;
+
+static void old_tokenize(const std::string& t)
+{
+    old_j = 0;
+    std::string tempword;
+    std::string temprawword;
+    char currentletter;
+
+    SDL_zeroa(old_argexists);
+
+    for (size_t i = 0; i < t.length(); i++)
+    {
+        currentletter = t[i];
+        if (currentletter == '(' || currentletter == ')' || currentletter == ',')
+        {
+            old_words[old_j] = tempword;
+            old_raw_words[old_j] = temprawword;
+            old_argexists[old_j] = old_words[old_j] != "";
+            for (size_t ii = 0; ii < old_words[old_j].length(); ii++)
+            {
+                old_words[old_j][ii] = SDL_tolower(old_words[old_j][ii]);
+            }
+            old_j++;
+            tempword = "";
+            temprawword = "";
+        }
+        else if (currentletter == ' ')
+        {
+            /* Ignore spaces unless it's part of a script name. */
+            temprawword += currentletter;
+        }
+        else
+        {
+            tempword += currentletter;
+            temprawword += currentletter;
+        }
+        if (old_j >= (int) SDL_arraysize(old_words))
+        {
+            break;
+        }
+    }
+
+    if (old_j < (int) SDL_arraysize(old_words))
+    {
+        const bool lastargexists = tempword != "";
+        if (lastargexists)
+        {
+            old_words[old_j] = tempword;
+            old_raw_words[old_j] = tempword;
+        }
+        old_argexists[old_j] = lastargexists;
+    }
+}
+
+/* Lines no built-in script has, but custom ones can */
+static const char* const odd_script_lines[] = {
+    "",
+    "   ",
+    "Say(2, Cyan)",
+    "iftrinkets(0, My Script )",
+    "text(cyan,0,0,1)  trailing words",
+    "((,,))",
+    "a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p",
+    "a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z,a,b,c,d,e,f,g,h,i,j,k,l,m,n"
+};
+
+/* Every line of every built-in script, then the odd ones. The old
+ * tokenizer was given std::strings, so it gets them here too. */
+static std::vector<const char*> script_lines;
+static std::vector<std::string> script_strings;
+
+static void add_script_lines(const BuiltinScript* table, const size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        for (size_t k = 0; k < table[i].numlines; k++)
+        {
+            script_lines.push_back(table[i].lines[k]);
+        }
+    }
+}
+
+static void load_script_lines(void)
+{
+    if (!script_lines.empty())
+    {
+        return;
+    }
+
+    const BuiltinScript* table;
+    size_t size = SCRIPT_getbuiltins(&table);
+    add_script_lines(table, size);
+    size = SCRIPT_getterminals(&table);
+    add_script_lines(table, size);
+    for (size_t i = 0; i < SDL_arraysize(odd_script_lines); i++)
+    {
+        script_lines.push_back(odd_script_lines[i]);
+    }
+
+    for (size_t i = 0; i < script_lines.size(); i++)
+    {
+        script_strings.push_back(script_lines[i]);
+    }
+}
+
+static bool tokenized_same(void)
+{
+    if (script.j != old_j)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < NUM_SCRIPT_ARGS; i++)
+    {
+        if (script.words[i] != old_words[i]
+        || script.getargexists(i) != old_argexists[i])
+        {
+            return false;
+        }
+
+        /* raw_words is only written up to the last argument */
+        const bool written = i < old_j || (i == old_j && old_argexists[i]);
+        if (written && script.getrawword(i) != old_raw_words[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Words past the end of a line are left as they were, so the lines go
+ * through both in the same order from the same start */
+static int test_tokenize(void)
+{
+    load_script_lines();
+
+    for (int i = 0; i < NUM_SCRIPT_ARGS; i++)
+    {
+        script.words[i] = "";
+        old_words[i] = "";
+    }
+
+    for (size_t i = 0; i < script_lines.size(); i++)
+    {
+        script.tokenize(script_lines[i]);
+        old_tokenize(script_strings[i]);
+
+        if (!tokenized_same())
+        {
+            vlog_error("FAIL tokenize() differs on \"%s\"", script_lines[i]);
+            return 1;
+        }
+    }
+
+    vlog_info("ok   tokenize() over %i script lines", (int) script_lines.size());
+    return 0;
+}
+
+static void tokenize_lines(int)
+{
+    for (size_t i = 0; i < script_lines.size(); i++)
+    {
+        script.tokenize(script_lines[i]);
+    }
+    sink += script.j;
+}
+
+static void old_tokenize_lines(int)
+{
+    for (size_t i = 0; i < script_strings.size(); i++)
+    {
+        old_tokenize(script_strings[i]);
+    }
+    sink += old_j;
+}
+
+/* The old code against the scalar kernels, if the scalar kernels are in
+ * use at all, then the scalar kernels against the SIMD ones */
+static int test_kernels(const char* name, void (*draw)(int))
+{
+    int failures = 0;
+
+    if (BlitDirectMatchesSDL())
+    {
+        failures += !draws_same(name, draw, BlitKernels_SDL, BlitKernels_Scalar);
+    }
+    failures += !draws_same(name, draw, BlitKernels_Scalar, BlitKernels_SIMD);
+
+    return failures;
+}
+
+int SELFTEST_run(void)
+{
+    int failures = 0;
+    char name[64];
+
+    if (BlitDirectMatchesSDL())
+    {
+        vlog_info("ok   BlendPixel() blends like SDL_BlitSurface()");
+    }
+    else
+    {
+        /* Not a failure, the game just keeps using SDL */
+        vlog_info("skip BlendPixel() rounds differently from this SDL, direct blits are off");
+    }
+
+    for (size_t i = 0; i < SDL_arraysize(test_sheets); i++)
+    {
+        drawn_sheet = test_sheets[i].sheet;
+
+        SDL_snprintf(name, sizeof(name), "coloured %s", test_sheets[i].name);
+        failures += test_kernels(name, draw_coloured);
+
+        SDL_snprintf(name, sizeof(name), "tinted %s", test_sheets[i].name);
+        failures += test_kernels(name, draw_tinted);
+    }
+
+    failures += test_kernels("font glyphs", draw_glyphs);
+    failures += test_font_idx();
+    failures += test_wraplayout();
+    failures += test_tokenize();
+    failures += test_tower_ring();
+    failures += test_hitest("sprites", graphics.sprites);
+    failures += test_hitest("flipsprites", graphics.flipsprites);
+    failures += test_collide();
+
+    /* Not a blit kernel, but the SDL setting scrolls the old way too */
+    failures += !draws_same("scrolling", scroll_buffer, BlitKernels_SDL, BlitKernels_Auto);
+
+    vlog_info("%i failed", failures);
+    return failures > 0;
+}
+
+/* What startup does with the sheets, minus decoding the PNGs */
+static void make_sheets(int)
+{
+    graphics.destroy();
+    graphics.MakeTileArray();
+    graphics.MakeSpriteArray();
+    graphics.maketelearray();
+    graphics.Makebfont();
+}
+
+/* What the sheets keep allocated, apart from SDL's own bookkeeping */
+static void report_sheets(void)
+{
+    const TileSheet* sheets[] = {
+        &graphics.tiles,
+        &graphics.tiles2,
+        &graphics.tiles3,
+        &graphics.entcolours,
+        &graphics.sprites,
+        &graphics.flipsprites,
+        &graphics.tele,
+        &graphics.bfont
+    };
+    size_t surfaces = 0;
+    size_t tiles = 0;
+    size_t pixel_bytes = 0;
+    size_t table_bytes = 0;
+
+    for (size_t i = 0; i < SDL_arraysize(sheets); i++)
+    {
+        if (sheets[i]->surface != NULL)
+        {
+            surfaces++;
+            pixel_bytes += sheets[i]->surface->pitch * sheets[i]->surface->h;
+        }
+        tiles += sheets[i]->size();
+        table_bytes += sheets[i]->rects.size() * sizeof(SDL_Rect)
+            + sheets[i]->masks.size() * sizeof(Uint32);
+    }
+
+    vlog_info(
+        "Sheets: %i tiles in %i surfaces, %i bytes of pixels, %i bytes of rects and masks",
+        (int) tiles,
+        (int) surfaces,
+        (int) pixel_bytes,
+        (int) table_bytes
+    );
+}
+
+static void benchmark_blits(
+    const char* name,
+    void (*draw)(int),
+    const size_t blits_per_draw
+) {
+    static const enum BlitKernels kernels[] = {
+        BlitKernels_SDL,
+        BlitKernels_Scalar,
+        BlitKernels_SIMD
+    };
+
+    for (size_t i = 0; i < SDL_arraysize(kernels); i++)
+    {
+        double seconds;
+
+        SetBlitKernels(kernels[i]);
+        seconds = time_per_call(draw);
+        vlog_info(
+            "%s, %s: %.1f ns per blit",
+            name,
+            kernelnames[kernels[i]],
+            seconds * 1e9 / blits_per_draw
+        );
+    }
+
+    SetBlitKernels(BlitKernels_Auto);
+}
+
+void SELFTEST_benchmark(void)
+{
+    drawn_sheet = &graphics.sprites;
+    benchmark_blits("coloured sprites", draw_coloured, sheet_blits());
+    benchmark_blits("tinted sprites", draw_tinted, sheet_blits());
+
+    drawn_sheet = &graphics.tiles;
+    benchmark_blits("coloured tiles", draw_coloured, sheet_blits());
+    benchmark_blits("tinted tiles", draw_tinted, sheet_blits());
+
+    benchmark_blits("font glyphs", draw_glyphs, glyph_blits());
+
+    load_font_positions();
+    if (!font_codepoints.empty())
+    {
+        vlog_info(
+            "font_idx(), std::map: %.1f ns per lookup",
+            time_per_call(lookup_old_font_idx) * 1e9 / font_codepoints.size()
+        );
+        vlog_info(
+            "font_idx(), table: %.1f ns per lookup",
+            time_per_call(lookup_font_idx) * 1e9 / font_codepoints.size()
+        );
+    }
+
+    vlog_info(
+        "PrintWrap() layout, uncached: %.1f ns per string",
+        time_per_call(wrap_uncached) * 1e9 / SDL_arraysize(wrap_texts)
+    );
+    vlog_info(
+        "PrintWrap() layout, cached: %.1f ns per string",
+        time_per_call(wrap_cached) * 1e9 / SDL_arraysize(wrap_texts)
+    );
+
+    load_script_lines();
+    vlog_info(
+        "tokenize(), old: %.1f ns per line",
+        time_per_call(old_tokenize_lines) * 1e9 / script_lines.size()
+    );
+    vlog_info(
+        "tokenize(), spans: %.1f ns per line",
+        time_per_call(tokenize_lines) * 1e9 / script_lines.size()
+    );
+
+    if (make_tower_buffers())
+    {
+        vlog_info("Tower scroll, flat: %.0f ns", time_per_call(scroll_tower_flat) * 1e9);
+        vlog_info("Tower scroll, ring: %.0f ns", time_per_call(scroll_tower_ring) * 1e9);
+        vlog_info("Tower present, flat: %.0f ns", time_per_call(present_tower_flat) * 1e9);
+        vlog_info("Tower present, ring: %.0f ns", time_per_call(present_tower_ring) * 1e9);
+    }
+    free_tower_buffers();
+
+    {
+        Uint32 state = 0x85EBCA6B;
+        map.towermode = false;
+        map.tileset = 1;
+        map.extrarow = 0;
+        random_room(&state);
+        vlog_info(
+            "collide(), old: %.1f ns per call",
+            time_per_call(oldcollide_room) * 1e9 / (42 * 32)
+        );
+        vlog_info(
+            "collide(), grid: %.1f ns per call",
+            time_per_call(collide_room) * 1e9 / (42 * 32)
+        );
+    }
+
+    map.tileset = 0;
+    for (int y = 0; y < 30; y++)
+    {
+        for (int x = 0; x < 40; x++)
+        {
+            const bool edge = x == 0 || x == 39 || y == 0 || y == 29;
+            map.contents[TILE_IDX(x, y)] = edge ? 1 : 0;
+        }
+    }
+    map.makecollision();
+    benchmark_entities(1000);
+    benchmark_entities(4000);
+    benchmark_entities(16000);
+
+    report_sheets();
+    vlog_info("Making the sheets: %.2f ms", time_per_call(make_sheets) * 1e3);
+}
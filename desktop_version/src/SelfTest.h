@@ -0,0 +1,11 @@
+#ifndef SELFTEST_H
+#define SELFTEST_H
+
+/* Checks the fast paths against the code they replaced, on the real game
+ * data. Returns 0 if everything matched, 1 otherwise. */
+int SELFTEST_run(void);
+
+/* Times the fast paths against the code they replaced and logs it */
+void SELFTEST_benchmark(void);
+
+#endif /* SELFTEST_H */
@@ -7,6 +7,29 @@
 #include "MakeAndPlay.h"
 #include "UtilityClass.h"
 
+static void makecollision(unsigned char* grid, const short* tiles, const int height)
+{
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = -1; x <= 40; x++)
+        {
+            const int tile = tiles[TILE_IDX(SDL_clamp(x, 0, 39), y)];
+            unsigned char flags = 0;
+
+            if (tile >= 12 && tile <= 27)
+            {
+                flags |= COLLIDE_SOLID;
+            }
+            if (tile >= 6 && tile <= 11)
+            {
+                flags |= COLLIDE_SPIKE;
+            }
+
+            grid[(x + 1) + y * 42] = flags;
+        }
+    }
+}
+
 towerclass::towerclass(void)
 {
     minitowermode = false;
@@ -14,6 +37,7 @@ towerclass::towerclass(void)
     SDL_memset(contents, 0, sizeof(contents));
     SDL_memset(back, 0, sizeof(back));
     SDL_memset(minitower, 0, sizeof(minitower));
+    SDL_memset(minicollision, 0, sizeof(minicollision));
 
     loadbackground();
     loadmap();
@@ -58,6 +82,20 @@ int towerclass::at(int xp, int yp, int yoff)
     }
 }
 
+int towerclass::collisionat(int xp, int yp)
+{
+    if (xp < -1 || xp > 40)
+    {
+        return 0;
+    }
+
+    if (minitowermode)
+    {
+        return minicollision[(xp + 1) + POS_MOD(yp, 100) * 42];
+    }
+    return collision[(xp + 1) + POS_MOD(yp, 700) * 42];
+}
+
 int towerclass::miniat(int xp, int yp, int yoff)
 {
     yp = (yp*8 + yoff) / 8;
@@ -187,6 +225,8 @@ void towerclass::loadminitower1(void)
 
     SDL_memcpy(minitower, tmap, sizeof(minitower));
 #endif
+
+    makecollision(minicollision, minitower, 100);
 }
 
 void towerclass::loadminitower2(void)
@@ -297,6 +337,8 @@ void towerclass::loadminitower2(void)
 
     SDL_memcpy(minitower, tmap, sizeof(minitower));
 #endif
+
+    makecollision(minicollision, minitower, 100);
 }
 
 
@@ -1137,4 +1179,6 @@ void towerclass::loadmap(void)
 
     SDL_memcpy(contents, tmap, sizeof(contents));
 #endif
+
+    makecollision(collision, contents, 700);
 }
@@ -1,6 +1,13 @@
 #ifndef TOWER_H
 #define TOWER_H
 
+/* What a tile is to collide(): spikes are only solid while invincible */
+enum
+{
+    COLLIDE_SOLID = 1,
+    COLLIDE_SPIKE = 2
+};
+
 class towerclass
 {
 public:
@@ -12,6 +19,8 @@ public:
 
     int miniat(int xp, int yp, int yoff);
 
+    int collisionat(int xp, int yp);
+
     void loadminitower1(void);
 
     void loadminitower2(void);
@@ -24,6 +33,11 @@ public:
     short contents[40 * 700];
     short minitower[40 * 100];
 
+    /* COLLIDE_* flags of contents and minitower, with an extra column on
+     * either side that repeats the edge like at() does */
+    unsigned char collision[42 * 700];
+    unsigned char minicollision[42 * 100];
+
     bool minitowermode;
 };
 
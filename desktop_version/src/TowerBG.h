@@ -5,8 +5,9 @@
 
 struct TowerBG
 {
+    /* A ring buffer; see ScrollRingSurface() */
     SDL_Surface* buffer;
-    SDL_Surface* buffer_lerp;
+    int buffer_origin;
     bool tdrawback;
     int bypos;
     int bscroll;
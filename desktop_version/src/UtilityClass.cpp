@@ -345,6 +345,18 @@ void VVV_fillstring(
     SDL_memset(buffer, fillchar, buffer_size - 1);
     buffer[buffer_size - 1] = '\0';
 }
+
+Uint32 fnv1a(Uint32 hash, const void* data, const size_t size)
+{
+    const Uint8* bytes = (const Uint8*) data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619;
+    }
+    return hash;
+}
+
 void _VVV_between(
     const char* original,
     const size_t left_length,
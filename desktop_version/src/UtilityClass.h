@@ -34,6 +34,12 @@ void VVV_fillstring(
     const char fillchar
 );
 
+/* FNV-1a. Start from FNV1A_BASIS, and pass the result back in as hash to
+ * carry on hashing more data. */
+#define FNV1A_BASIS 2166136261U
+
+Uint32 fnv1a(Uint32 hash, const void* data, size_t size);
+
 #define INBOUNDS_VEC(index, vector) ((int) index >= 0 && (int) index < (int) vector.size())
 #define INBOUNDS_ARR(index, array) ((int) index >= 0 && (int) index < (int) SDL_arraysize(array))
 
@@ -60,3 +60,11 @@ float xoshiro_rand(void)
 {
     return ((float) xoshiro_next()) / ((float) UINT32_MAX);
 }
+
+void xoshiro_getstate(uint32_t state[4])
+{
+    state[0] = s[0];
+    state[1] = s[1];
+    state[2] = s[2];
+    state[3] = s[3];
+}
@@ -14,6 +14,8 @@ uint32_t xoshiro_next(void);
 
 float xoshiro_rand(void);
 
+void xoshiro_getstate(uint32_t state[4]);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -11,6 +11,7 @@
 #include "Entity.h"
 #include "Exit.h"
 #include "FileSystemUtils.h"
+#include "FrameHash.h"
 #include "Game.h"
 #include "Graphics.h"
 #include "Input.h"
@@ -24,6 +25,9 @@
 #include "RenderFixed.h"
 #include "Screen.h"
 #include "Script.h"
+#ifdef SELFTEST
+#include "SelfTest.h"
+#endif
 #include "UtilityClass.h"
 #include "Vlogging.h"
 
@@ -58,6 +62,13 @@ static std::string playassets;
 
 static std::string playtestname;
 
+static bool headless = false;
+static Uint32 headlessframes = 0;
+#ifdef SELFTEST
+static bool selftest = false;
+static bool benchmark = false;
+#endif
+
 static volatile Uint64 time_ = 0;
 static volatile Uint64 timePrev = 0;
 static volatile Uint32 accumulator = 0;
@@ -86,6 +97,12 @@ static void runscript(void)
     script.run();
 }
 
+static void rungamelogic(void)
+{
+    gamelogic();
+    FRAMEHASH_record();
+}
+
 static void teleportermodeinput(void)
 {
     if (game.useteleporter)
@@ -135,7 +152,7 @@ static const inline struct ImplFunc* get_gamestate_funcs(
         {Func_fixed, gamerenderfixed},
         {Func_delta, gamerender},
         {Func_input, gameinput},
-        {Func_fixed, gamelogic},
+        {Func_fixed, rungamelogic},
     FUNC_LIST_END
 
     FUNC_LIST_BEGIN(TITLEMODE)
@@ -351,6 +368,8 @@ static void inline fixedloop(void)
 
 static void inline deltaloop(void);
 
+static void headlessloop(void);
+
 static void cleanup(void);
 
 #ifdef __EMSCRIPTEN__
@@ -366,6 +385,7 @@ int main(int argc, char *argv[])
 {
     char* baseDir = NULL;
     char* assetsPath = NULL;
+    char* hashframespath = NULL;
 
     vlog_init();
 
@@ -438,6 +458,45 @@ int main(int argc, char *argv[])
                 playassets = "levels/" + std::string(argv[i]) + ".vvvvvv";
             })
         }
+        else if (ARG("-headless"))
+        {
+            ARG_INNER({
+                i++;
+                headless = true;
+                headlessframes = SDL_max(help.Int(argv[i]), 0);
+            })
+        }
+#ifdef SELFTEST
+        else if (ARG("-selftest"))
+        {
+            headless = true;
+            selftest = true;
+        }
+        else if (ARG("-benchmark"))
+        {
+            headless = true;
+            benchmark = true;
+        }
+#endif
+        else if (ARG("-hashframes"))
+        {
+            ARG_INNER({
+                i++;
+                hashframespath = argv[i];
+            })
+        }
+        else if (ARG("-comparehashes"))
+        {
+            if (i + 2 < argc)
+            {
+                VVV_exit(FRAMEHASH_compare(argv[i + 1], argv[i + 2]));
+            }
+            else
+            {
+                vlog_error("%s option requires two arguments.", argv[i]);
+                VVV_exit(1);
+            }
+        }
         else if (ARG("-nooutput"))
         {
             vlog_toggle_output(0);
@@ -475,18 +534,34 @@ int main(int argc, char *argv[])
         }
     }
 
+    if (hashframespath != NULL && !FRAMEHASH_open(hashframespath))
+    {
+        VVV_exit(1);
+    }
+
     if(!FILESYSTEM_init(argv[0], baseDir, assetsPath))
     {
         vlog_error("Unable to initialize filesystem!");
         VVV_exit(1);
     }
 
-    SDL_Init(
-        SDL_INIT_VIDEO |
-        SDL_INIT_AUDIO |
-        SDL_INIT_JOYSTICK |
-        SDL_INIT_GAMECONTROLLER
-    );
+    if (headless)
+    {
+        SDL_Init(SDL_INIT_EVENTS);
+        gameScreen.headless = true;
+        music.headless = true;
+        script.fixedseed = true;
+        FILESYSTEM_setReadOnly(true);
+    }
+    else
+    {
+        SDL_Init(
+            SDL_INIT_VIDEO |
+            SDL_INIT_AUDIO |
+            SDL_INIT_JOYSTICK |
+            SDL_INIT_GAMECONTROLLER
+        );
+    }
     if (SDL_IsTextInputActive() == SDL_TRUE)
     {
         SDL_StopTextInput();
@@ -665,6 +740,25 @@ int main(int argc, char *argv[])
     gamestate_funcs = get_gamestate_funcs(game.gamestate, &num_gamestate_funcs);
     loop_assign_active_funcs();
 
+#ifdef SELFTEST
+    if (selftest)
+    {
+        VVV_exit(SELFTEST_run());
+    }
+
+    if (benchmark)
+    {
+        SELFTEST_benchmark();
+        VVV_exit(0);
+    }
+#endif
+
+    if (headless)
+    {
+        headlessloop();
+        VVV_exit(0);
+    }
+
 #ifdef __EMSCRIPTEN__
     emscripten_set_main_loop(emscriptenloop, 0, 0);
 #else
@@ -706,6 +800,7 @@ static void cleanup(void)
     graphics.destroy_buffers();
     graphics.destroy();
     music.destroy();
+    FRAMEHASH_close();
     NETWORK_shutdown();
     SDL_Quit();
     FILESYSTEM_deinit();
@@ -717,6 +812,22 @@ SDL_NORETURN void VVV_exit(const int exit_code)
     exit(exit_code);
 }
 
+/* One fixed-rate frame, up to the point where it would render */
+static void inline fixedframe(void)
+{
+    enum IndexCode index_code = increment_func_index();
+
+    if (index_code == Index_end)
+    {
+        loop_assign_active_funcs();
+    }
+
+    /* We are done rendering. */
+    graphics.renderfixedpost();
+
+    fixedloop();
+}
+
 static void inline deltaloop(void)
 {
     //timestep limit to 30
@@ -727,19 +838,9 @@ static void inline deltaloop(void)
 
     while (accumulator >= timesteplimit)
     {
-        enum IndexCode index_code = increment_func_index();
-
-        if (index_code == Index_end)
-        {
-            loop_assign_active_funcs();
-        }
-
         accumulator = SDL_fmodf(accumulator, timesteplimit);
 
-        /* We are done rendering. */
-        graphics.renderfixedpost();
-
-        fixedloop();
+        fixedframe();
     }
     const float alpha = game.over30mode ? static_cast<float>(accumulator) / timesteplimit : 1.0f;
     graphics.alpha = alpha;
@@ -765,6 +866,32 @@ static void inline deltaloop(void)
     }
 }
 
+/* Runs fixed frames back to back, never rendering and never waiting for
+ * the timestep, then reports how fast that went */
+static void headlessloop(void)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    for (Uint32 i = 0; i < headlessframes; i++)
+    {
+        fixedframe();
+    }
+
+    const double seconds = (double) (SDL_GetPerformanceCounter() - start)
+        / SDL_GetPerformanceFrequency();
+    vlog_info(
+        "Simulated %u frames in %.3f seconds (%.0f frames per second)",
+        headlessframes,
+        seconds,
+        seconds > 0.0 ? headlessframes / seconds : 0.0
+    );
+    vlog_info(
+        "At most %i entity slots were in use (%i reserved)",
+        (int) obj.entities_highwater,
+        entityclass::entities_reserve
+    );
+}
+
 static enum LoopCode loop_begin(void)
 {
     if (game.inputdelay)